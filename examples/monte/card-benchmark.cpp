@@ -0,0 +1,64 @@
+/*
+ *    Copyright (c) 2024 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a benchmark that repeatedly constructs,
+ *      copies and compares playing cards.
+ *
+ */
+
+
+#include <stdlib.h>
+
+#include "Card.hpp"
+
+
+/**
+ *  @brief
+ *    This is the main program entry point.
+ *
+ *  The optional argument is the number of full card sets, of every
+ *  suit and rank, to construct, copy and compare.
+ *
+ *  @param[in]  argc  The number of arguments.
+ *  @param[in]  argv  The arguments.
+ *
+ *  @returns
+ *    EXIT_SUCCESS if every copy compared equal to its original;
+ *    otherwise, EXIT_FAILURE.
+ *
+ */
+int
+main(int argc, char *argv[])
+{
+	const long kIterations = (argc > 1) ? strtol(argv[1], NULL, 0) : 100000;
+	long       lMatches    = 0;
+
+	for (long i = 0; i < kIterations; i++) {
+		for (int s = kCardSuitFirst; s < kCardSuits; s++) {
+			for (int r = kCardRankFirst; r < kCardRanks; r++) {
+				const Card lCard(static_cast<CardSuit>(s), static_cast<CardRank>(r));
+				const Card lCopy(lCard);
+
+				lMatches += (lCopy == lCard);
+			}
+		}
+	}
+
+	return ((lMatches == kIterations * kCardSuits * kCardRanks) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
@@ -0,0 +1,74 @@
+/*
+ *    Copyright (c) 2024 Nuovation System Designs, LLC
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements a test of the playing card object.
+ *
+ */
+
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "Card.hpp"
+
+
+/**
+ *  @brief
+ *    This is the main program entry point.
+ *
+ *  Every card, of every suit and rank, is checked to retain its suit
+ *  and rank, to compare equal to a copy of itself and to compare
+ *  unequal to every other card.
+ *
+ *  @returns
+ *    EXIT_SUCCESS if every check passed; otherwise, EXIT_FAILURE.
+ *
+ */
+int
+main(void)
+{
+	int lFailures = 0;
+
+	for (int s1 = kCardSuitFirst; s1 < kCardSuits; s1++) {
+		for (int r1 = kCardRankFirst; r1 < kCardRanks; r1++) {
+			const Card lCard(static_cast<CardSuit>(s1), static_cast<CardRank>(r1));
+			const Card lCopy(lCard);
+
+			if (lCard.GetSuit() != s1 || lCard.GetRank() != r1 || !(lCopy == lCard)) {
+				fprintf(stderr, "card %d/%d did not survive construction or copy\n", s1, r1);
+				lFailures++;
+			}
+
+			for (int s2 = kCardSuitFirst; s2 < kCardSuits; s2++) {
+				for (int r2 = kCardRankFirst; r2 < kCardRanks; r2++) {
+					const Card lOther(static_cast<CardSuit>(s2), static_cast<CardRank>(r2));
+
+					if ((lOther == lCard) != (s1 == s2 && r1 == r2)) {
+						fprintf(stderr, "cards %d/%d and %d/%d compared incorrectly\n", s1, r1, s2, r2);
+						lFailures++;
+					}
+				}
+			}
+		}
+	}
+
+	printf("%d failure(s)\n", lFailures);
+
+	return ((lFailures == 0) ? EXIT_SUCCESS : EXIT_FAILURE);
+}
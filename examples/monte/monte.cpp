@@ -161,6 +161,13 @@ ThreadPlay(void *inArg)
 	status = pthread_mutex_unlock(tsp.mLock);
 	assert(status == 0);
 
+	// Wait at the serialization barrier again until all other
+	// threads have also revealed their card since, should ours be
+	// the "monte" card, they compare against and display it.
+
+	status = tsp.mBarrier->Wait();
+	assert(status == 0);
+
 	/* Delete the card since we are done with it. */
 
 	delete myCard;
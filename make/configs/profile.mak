@@ -0,0 +1,43 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+
+##
+#    @file
+#      This file defines build-specific options for the "profile" build
+#      configuration.
+#
+#      Programs are optimized as for release but, such that their call
+#      stacks may be sampled and attributed, with symbols and frame
+#      pointers. When 'ProfileTool' is 'gprof', they are instrumented
+#      for it as well; since only this configuration instruments for
+#      it, other configurations are unaffected by 'ProfileTool'.
+#
+#      Like any other configuration, it is built by all-configuration
+#      builds, such that it does not break unnoticed.
+#
+
+#
+#  First, include the common build definitions.
+#
+
+include configs/common.mak
+
+OPTIMIZER	= $(OptimizeMore) $(DebugFlag)
+LANGFLAGS	+= $(call ToolDeassertLanguageFlag,$(LangOmitFramePointer))
+DEFINES		+= NDEBUG=1
+UNDEFINES       += DEBUG
+ProfileInstrumentation	= $(ProfileTool)
@@ -22,6 +22,19 @@
 
 LNDIR		= lndir -silent
 SIZE		= /usr/bin/stat -f "%z"
+TIMESTAMP	= perl -MTime::HiRes=time -e 'printf("%.6f\n", time)'
+
+# Rename a directory, failing rather than moving it into the
+# destination directory if that exists and is not empty.
+
+MVDIR		= perl -e 'rename($$ARGV[0], $$ARGV[1]) || die("$$ARGV[1]: $$!\n")'
+
+# Commands, in order of preference, with which link-tree populates a
+# directory with a tree whose files it shares rather than copies and,
+# if asserted by 'UseHardLinkedTrees', by hard link.
+
+LinkTreeCommands		= 'cp -R -p -c'
+LinkTreeHardLinkCommands	= $(Null)
 
 # host-install <source path> <destination path>
 #
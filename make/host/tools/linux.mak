@@ -22,6 +22,19 @@
 
 LNDIR		= cp -rs
 SIZE		= /usr/bin/stat -c "%s"
+TIMESTAMP	= date +%s.%N
+
+# Rename a directory, failing rather than moving it into the
+# destination directory if that exists and is not empty.
+
+MVDIR		= mv -T
+
+# Commands, in order of preference, with which link-tree populates a
+# directory with a tree whose files it shares rather than copies and,
+# if asserted by 'UseHardLinkedTrees', by hard link.
+
+LinkTreeCommands		= 'cp -R -p --reflink=always'
+LinkTreeHardLinkCommands	= 'cp -R -l'
 
 # host-install <source path> <destination path>
 #
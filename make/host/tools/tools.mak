@@ -25,6 +25,11 @@
 # locations (e.g. /bin, /usr/bin, /sbin, and /usr/sbin).
 #
 
+CKSUM                        = cksum
+
+CMP                          = cmp
+CMPFLAGS                     = -s
+
 GREP                         = grep
 GREPFLAGS                    =
 
@@ -34,6 +39,9 @@ INSTALLFLAGS                 = -C
 MKDIR                        = mkdir
 MKDIRFLAGS                   = -p
 
+MV                           = mv
+MVFLAGS                      = -f
+
 #
 # Use "rmdir -p --ignore-fail-on-non-empty" to remove non-empty directories
 # and their ancestors
@@ -60,12 +68,154 @@ RMFLAGS                      = -f $(RMFLAGS_BuildVerbose_$(BuildVerbose_Y))
 SED                          = sed
 SEDFLAGS                     =
 
+TOUCH                        = touch
+TOUCHFLAGS                   =
+
+ZSTD                         = zstd
+ZSTDFLAGS                    = -T0 -q
+
+#
+# Decompressors used for expanding archives, preferring those that
+# decompress in parallel where they are available.
+#
+
+FirstAvailableTool           = $(firstword $(foreach tool,$(1),$(if $(shell command -v $(tool) 2> /dev/null),$(tool))) $(lastword $(1)))
+
+GZIPEXPANDER                 = $(call FirstAvailableTool,pigz gzip)
+BZIP2EXPANDER                = $(call FirstAvailableTool,pbzip2 lbzip2 bzip2)
+XZEXPANDER                   = xz -T0
+ZSTDEXPANDER                 = $(ZSTD) $(ZSTDFLAGS)
+
+PERF                         = perf
+PERFRECORDFLAGS              = --call-graph=fp
+
+GPROF                        = gprof
+GPROFFLAGS                   =
+
+#
+# Script used for benchmarking the latency of commands.
+#
+
+MKBENCHMARK                 := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkbenchmark
+MKBENCHMARKFLAGS             =
+
+#
+# Script used for generating a build timeline from build step trace
+# records.
+#
+
+MKBUILDTRACE                := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkbuildtrace
+MKBUILDTRACEFLAGS            =
+
+#
+# Script used for reporting where compile time is spent from
+# compile-time traces.
+#
+
+MKCOMPILEPROFILE            := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkcompileprofile
+MKCOMPILEPROFILEFLAGS        =
+
+#
+# Script used for generating an lcov tracefile from the coverage data
+# of an object.
+#
+
+MKCOVERAGE                  := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkcoverage
+MKCOVERAGEFLAGS              =
+
+#
+# Script used for merging lcov tracefiles into an lcov, JSON, text and
+# HTML coverage report.
+#
+
+MKCOVERAGEREPORT            := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkcoveragereport
+MKCOVERAGEREPORTFLAGS        =
+
+#
+# Script used for merging dependency files into a dependency database.
+#
+
+MKDEPENDDB                  := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkdependdb
+MKDEPENDDBFLAGS              = -s $(BaseDependSuffix)
+
+#
+# Script used for generating the run-time dispatcher for
+# multi-versioned functions.
+#
+
+MKDISPATCHER                := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkdispatcher
+MKDISPATCHERFLAGS            =
+
+#
+# Script used for reporting the rebuild impact of headers from
+# dependency files.
+#
+
+MKHEADERIMPACT              := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkheaderimpact
+MKHEADERIMPACTFLAGS          =
+
+#
+# Script used for analyzing unused include directories from dependency
+# files.
+#
+
+MKINCLUDEANALYSIS           := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkincludeanalysis
+MKINCLUDEANALYSISFLAGS       =
+
 #
-# Script used for creating and updating build generation numbers.
+# Script used for running a command, accounting for its peak memory
+# and CPU time in a resource ledger.
 #
 
-MKGENERATION                := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkgeneration
-MKGENERATIONFLAGS            =
+MKRESOURCEACCOUNT           := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkresourceaccount
+MKRESOURCEACCOUNTFLAGS       =
+
+#
+# Script used for generating folded call stacks and a top-functions
+# report from the profile of a program.
+#
+
+MKPROFILEREPORT             := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkprofilereport
+MKPROFILEREPORTFLAGS         =
+
+#
+# Script used for reporting the heaviest compiles and links from a
+# resource ledger.
+#
+
+MKRESOURCEREPORT            := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mkresourcereport
+MKRESOURCEREPORTFLAGS        =
+
+#
+# Script used for reporting the section sizes of objects, archives,
+# libraries and programs.
+#
+
+MKSIZEREPORT                := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mksizereport
+MKSIZEREPORTFLAGS            =
+
+#
+# Script used for selecting and ordering the shard of tests to run.
+#
+
+MKTESTPLAN                  := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mktestplan
+MKTESTPLANFLAGS              =
+
+#
+# Script used for generating a JUnit XML, JSON and text test report
+# from test results.
+#
+
+MKTESTREPORT                := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mktestreport
+MKTESTREPORTFLAGS            =
+
+#
+# Script used for running a test with a timeout and capturing its
+# output and result.
+#
+
+MKTESTRUN                   := $(BuildRoot)/third_party/nuovations-build-make/repo/scripts/mktestrun
+MKTESTRUNFLAGS               =
 
 # create-directory <path name>
 #
@@ -129,6 +279,34 @@ $(Echo) "Shadowing \"$(call GenerateBuildRootEllipsedPath,$(1))\""
 $(Verbose)$(LNDIR) $(1)/. $(2)
 endef
 
+# move-if-change <source> <destination> [<witness>]
+#
+# Common macro to move the specified source file to the destination
+# only if their contents differ, otherwise removing the source, such
+# that the destination timestamp only changes when its contents do.
+# The witness, if specified, is updated either way such that, made as
+# the target in place of the destination, it is current thereafter.
+
+define move-if-change
+$(Verbose)if $(CMP) $(CMPFLAGS) "$(1)" "$(2)"; then \
+        $(RM) $(RMFLAGS) "$(1)"; \
+else \
+        $(MV) $(MVFLAGS) "$(1)" "$(2)"; \
+fi
+$(if $(3),$(Verbose)$(TOUCH) $(TOUCHFLAGS) "$(3)")
+endef
+
+# witnessed-result
+#
+# Common macro used in target commands for a file only updated when
+# its contents change and made by way of its witness, the target
+# dependency. Should the file have since been removed, so too is its
+# witness, such that both are made anew by the next build.
+
+define witnessed-result
+$(Verbose)test -f "$(@)" || $(RM) $(RMFLAGS) "$(<)"
+endef
+
 # Common macro used in target commands for copying a file as the
 # target goal from the target dependency.
 
@@ -207,17 +385,19 @@ $(Verbose)extension=`echo $(1) | awk -F . '{if (NF > 1) {print $$NF}}'`; \
 if [ $$extension = "7z" ]; then \
         7zr x -yw"$(2)" "$(1)" > /dev/null; \
 elif [ $$extension = "bz2" ]; then \
-        tar -C "$(2)" --bzip2 -xf "$(1)"; \
+        tar -C "$(2)" --use-compress-program="$(BZIP2EXPANDER)" -xf "$(1)"; \
 elif [ $$extension = "gz" ]; then \
-        tar -C "$(2)" --gzip -xf "$(1)"; \
+        tar -C "$(2)" --use-compress-program="$(GZIPEXPANDER)" -xf "$(1)"; \
 elif [ $$extension = "tar" ]; then \
         tar -C "$(2)" -xf "$(1)"; \
 elif [ $$extension = "xz" ]; then \
-        tar -C "$(2)" --xz -xf "$(1)"; \
+        tar -C "$(2)" --use-compress-program="$(XZEXPANDER)" -xf "$(1)"; \
 elif [ $$extension = "Z" ]; then \
         tar -C "$(2)" -Z -xf "$(1)"; \
 elif [ $$extension = "zip" ]; then \
         unzip -d "$(2)" -qo "$(1)"; \
+elif [ $$extension = "zst" ]; then \
+        tar -C "$(2)" --use-compress-program="$(ZSTDEXPANDER)" -xf "$(1)"; \
 else \
         echo "Unrecognized archive extension \"$$extension\"!"; \
         false; \
@@ -247,18 +427,64 @@ $(Verbose)for patch in $(3); do \
 done
 endef
 
+# link-tree <source directory> <destination directory>
+#
+# Populate the destination directory, replacing any existing one, with
+# the source tree, sharing rather than copying its files where the
+# host and file system allow, per the host 'LinkTreeCommands', for
+# example, by reflink on Linux or by clone on Darwin, otherwise
+# copying them.
+#
+# With 'UseHardLinkedTrees' asserted, files are otherwise hard linked
+# where the host allows. Since a hard-linked file is one and the same
+# as its source, the source files are first made read-only such that
+# a build writing one in place fails rather than modifying it for
+# every other tree sharing it.
+#
+
+UseHardLinkedTrees_Y         = $(call IsYes,$(UseHardLinkedTrees))
+
+LinkTreeHardLinkCommands_UseHardLinkedTrees_  := $(Null)
+LinkTreeHardLinkCommands_UseHardLinkedTrees_N := $(LinkTreeHardLinkCommands_UseHardLinkedTrees_)
+LinkTreeHardLinkCommands_UseHardLinkedTrees_Y  = $(LinkTreeHardLinkCommands)
+
+define link-tree
+$(if $(UseHardLinkedTrees_Y),$(Verbose)find "$(1)" -type f -perm -u+w -exec chmod a-w {} +)
+$(Verbose)for command in $(LinkTreeCommands) $(LinkTreeHardLinkCommands_UseHardLinkedTrees_$(UseHardLinkedTrees_Y)); do \
+        $(RM) $(RMFLAGS) -r "$(2)"; \
+        $$command "$(1)" "$(2)" 2> /dev/null && exit 0; \
+done; \
+$(RM) $(RMFLAGS) -r "$(2)"; \
+cp -R -p "$(1)" "$(2)"
+endef
+
 # Fail the build if either HostOS or HostTuple are not defined.
 
-# UpdateGenerationPath <path>
+# UpdateGenerationPath <path> <members>
 #
 # Scope: Private
 #
-# Update the generation number associated with an archive, image,
-# library, program or other target.
+# Update the generation digest associated with an archive, image,
+# library, program or other target from the contents of its member
+# objects, only changing it when those contents have changed, and
+# its witness regardless.
 #
 define UpdateGenerationPath
-$(Echo) "Updating ($(notdir $(MKGENERATION))) \"$(1)\""
-$(Verbose)$(MKGENERATION) $(MKGENERATIONFLAGS) "$(1)"
+$(Echo) "Checking generation \"$(1)\""
+$(Verbose)$(CKSUM) $(2) > "$(1).N"
+$(call move-if-change,$(1).N,$(1),$(call GenerateWitnessPaths,$(1)))
+endef
+
+# UpdateDependDatabasePath <path> <depend paths> [<flags>]
+#
+# Scope: Private
+#
+# Merge the specified dependency paths into the dependency database
+# at the specified path if it does not exist or if any of the
+# dependency paths are newer than it.
+#
+define UpdateDependDatabasePath
+$(Verbose)$(MKDEPENDDB) $(MKDEPENDDBFLAGS) $(3) "$(1)" $(2)
 endef
 
 $(call ErrorIfUndefined,HostOS)
@@ -44,4 +44,21 @@ $(call ErrorIfUndefined,SubMakefiles)
 
 BuildCurrentDirectory=
 
+# When dependencies are pruned of system and tool chain headers, check
+# whether the tool chain fingerprint has changed once, up front, for
+# the entire build.
+
+ToolchainFingerprintForce = force
+
+ifeq ($(call IsYes,$(UsePrunedDependencies)),Y)
+PrepareTargets += $(ToolchainFingerprintPath)
+endif
+
+CleanPaths += $(ToolchainFingerprintPath) $(ProfileInstrumentationPath)
+
+# Profile-guided optimization profile data survives cleaning, since the
+# optimized build is made from a clean tree, but not dist-cleaning.
+
+local-distclean: profile-clean
+
 include post.mak
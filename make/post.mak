@@ -31,15 +31,23 @@ include post/rules.mak
 # environment. In such case, there are effectively no dependencies to
 # include until they've been generated the first time.
 #
+# Once a build has merged the dependencies into the dependency
+# database, include only it, rather than each dependency file, such
+# that make reads each unique prerequisite once.
+#
 # Finally, we do not want to let dependencies get in the way of build
 # cleaning make goals.
 #
 
 ifdef Dependencies
+ifeq ($(filter clean distclean,$(MAKECMDGOALS)),)
+ifneq ($(wildcard $(DependDatabasePath)),)
+include $(DependDatabasePath)
+else
 VerifiedDependencies := $(foreach depend,$(Dependencies),$(wildcard $(depend)))
 ifdef VerifiedDependencies
-ifeq ($(filter clean distclean,$(MAKECMDGOALS)),)
 include $(VerifiedDependencies)
-endif
 endif # VerifiedDependencies
+endif # $(DependDatabasePath)
+endif
 endif # Dependencies
@@ -53,56 +53,75 @@ CompileVerb             = Compiling
 DependVerb              = Depending
 DisassembleVerb         = Disassembling
 ExecuteVerb             = Executing
+MergeVerb               = Merging
+TrainVerb               = Training
 TranslateVerb           = Translating
 SignVerb                = Signing
+PackageVerb             = Packaging
+ProfileVerb             = Profiling
+GenerateVerb            = Generating
 
 # Transform a raw assembler file into an object file.
 
 define assemble-asm
+$(call trace-begin,$(AssembleVerb))
 $(Echo) "$(AssembleVerb) ($(ASName)) \"$<\""
 $(tool-assemble-asm)
+$(trace-end)
 endef
 
 # Transform an assembler with C preprocessor file into a raw assembler file.
 
 define preprocess-asm
+$(call trace-begin,$(PreprocessVerb))
 $(Echo) "$(PreprocessVerb) ($(CPPName)) \"$<\""
 $(tool-preprocess-asm)
+$(trace-end)
 endef
 
 # Transform an assembler with C preprocessor file into an object file.
 
 define preprocess-and-assemble-asm
+$(call trace-begin,$(AssembleVerb))
 $(Echo) "$(AssembleVerb) ($(ASName)) \"$<\""
 $(tool-preprocess-and-assemble-asm)
+$(trace-end)
 endef
 
 # Transform a C file into a preprocessed C file.
 
 define preprocess-c
+$(call trace-begin,$(PreprocessVerb))
 $(Echo) "$(PreprocessVerb) ($(CPPName)) \"$<\""
 $(tool-preprocess-c)
+$(trace-end)
 endef
 
 # Transform a C++ file into a preprocessed C++ file.
 
 define preprocess-c++
+$(call trace-begin,$(PreprocessVerb))
 $(Echo) "$(PreprocessVerb) ($(CPPName)) \"$<\""
 $(tool-preprocess-c++)
+$(trace-end)
 endef
 
 # Transform an Objective C file into a preprocessed Objective C file.
 
 define preprocess-objective-c
+$(call trace-begin,$(PreprocessVerb))
 $(Echo) "$(PreprocessVerb) ($(CPPName)) \"$<\""
 $(tool-preprocess-objective-c)
+$(trace-end)
 endef
 
 # Transform an Objective C++ file into a preprocessed Objective C++ file.
 
 define preprocess-objective-c++
+$(call trace-begin,$(PreprocessVerb))
 $(Echo) "$(PreprocessVerb) ($(CPPName)) \"$<\""
 $(tool-preprocess-objective-c++)
+$(trace-end)
 endef
 
 # While a bit of a misnomer, for human readability, these next four
@@ -114,155 +133,199 @@ endef
 # Transform a C file into a raw assembler file. 
 
 define preprocess-and-compile-c
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CCName)) \"$<\""
 $(tool-preprocess-and-compile-c)
+$(trace-end)
 endef
 
 # Transform a C++ file into a raw assembler file. 
 
 define preprocess-and-compile-c++
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CXXName)) \"$<\""
 $(tool-preprocess-and-compile-c++)
+$(trace-end)
 endef
 
 # Transform an Objective C file into a raw assembler file. 
 
 define preprocess-and-compile-objective-c
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CCName)) \"$<\""
 $(tool-preprocess-and-compile-objective-c)
+$(trace-end)
 endef
 
 # Transform an Objective C++ file into a raw assembler file. 
 
 define preprocess-and-compile-objective-c++
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CXXName)) \"$<\""
 $(tool-preprocess-and-compile-objective-c++)
+$(trace-end)
 endef
 
 # Transform a preprocessed C file into a raw assembler file.
 
 define compile-c
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CCName)) \"$<\""
 $(tool-compile-c)
+$(trace-end)
 endef
 
 # Transform a preprocessed C++ file into a raw assembler file.
 
 define compile-c++
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CXXName)) \"$<\""
 $(tool-compile-c++)
+$(trace-end)
 endef
 
 # Transform a preprocessed Objective C file into a raw assembler file.
 
 define compile-objective-c
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CCName)) \"$<\""
 $(tool-compile-objective-c)
+$(trace-end)
 endef
 
 # Transform a preprocessed Objective C++ file into a raw assembler file.
 
 define compile-objective-c++
+$(call trace-begin,$(DisassembleVerb))
 $(Echo) "$(DisassembleVerb) ($(CXXName)) \"$<\""
 $(tool-compile-objective-c++)
+$(trace-end)
 endef
 
 # Transform a C file into an object file.
 
 define preprocess-compile-and-assemble-c
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CCName)) \"$<\""
 $(tool-preprocess-compile-and-assemble-c)
+$(trace-end)
 endef
 
 # Transform a C++ file into an object file.
 
 define preprocess-compile-and-assemble-c++
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CXXName)) \"$<\""
 $(tool-preprocess-compile-and-assemble-c++)
+$(trace-end)
 endef
 
 # Transform an Objective C file into an object file.
 
 define preprocess-compile-and-assemble-objective-c
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CCName)) \"$<\""
 $(tool-preprocess-compile-and-assemble-objective-c)
+$(trace-end)
 endef
 
 # Transform an Objective C++ file into an object file.
 
 define preprocess-compile-and-assemble-objective-c++
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CXXName)) \"$<\""
 $(tool-preprocess-compile-and-assemble-objective-c++)
+$(trace-end)
 endef
 
 # Transform a preprocessed C file into an object file.
 
 define compile-and-assemble-c
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CCName)) \"$<\""
 $(tool-compile-and-assemble-c)
+$(trace-end)
 endef
 
 # Transform a preprocessed C++ file into an object file.
 
 define compile-and-assemble-c++
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CXXName)) \"$<\""
 $(tool-compile-and-assemble-c++)
+$(trace-end)
 endef
 
 # Transform a preprocessed Objective C file into an object file.
 
 define compile-and-assemble-objective-c
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CCName)) \"$<\""
 $(tool-compile-and-assemble-objective-c)
+$(trace-end)
 endef
 
 # Transform a preprocessed Objective C++ file into an object file.
 
 define compile-and-assemble-objective-c++
+$(call trace-begin,$(CompileVerb))
 $(Echo) "$(CompileVerb) ($(CXXName)) \"$<\""
 $(tool-compile-and-assemble-objective-c++)
+$(trace-end)
 endef
 
 # Transform an assembler with C preprocessor file into a dependency file.
 
 define depend-asm
+$(call trace-begin,$(DependVerb))
 $(Echo) "$(DependVerb) ($(DEPENDName)) \"$<\""
 $(tool-depend-asm)
+$(trace-end)
 endef
 
 # Transform a C file into a dependency file.
 
 define depend-c
+$(call trace-begin,$(DependVerb))
 $(Echo) "$(DependVerb) ($(DEPENDName)) \"$<\""
 $(tool-depend-c)
+$(trace-end)
 endef
 
 # Transform a C++ file into a dependency file.
 
 define depend-c++
+$(call trace-begin,$(DependVerb))
 $(Echo) "$(DependVerb) ($(DEPENDName)) \"$<\""
 $(tool-depend-c++)
+$(trace-end)
 endef
 
 # Transform an Objective C file into a dependency file.
 
 define depend-objective-c
+$(call trace-begin,$(DependVerb))
 $(Echo) "$(DependVerb) ($(DEPENDName)) \"$<\""
 $(tool-depend-objective-c)
+$(trace-end)
 endef
 
 # Transform an Objective C++ file into a dependency file.
 
 define depend-objective-c++
+$(call trace-begin,$(DependVerb))
 $(Echo) "$(DependVerb) ($(DEPENDName)) \"$<\""
 $(tool-depend-objective-c++)
+$(trace-end)
 endef
 
 # Transform a dependency file into a processed dependency file.
 
 define process-depend
+$(call trace-begin,$(DependVerb))
 $(Echo) "Processing dependencies for \"$(<F)\""
 $(tool-process-depend)
+$(trace-end)
 endef
 
 # XXX - Move this somewhere else
@@ -272,29 +335,204 @@ ResultsPath                     = $(notdir $(1))
 # Transform a set of objects into an archive library file.
 
 define create-archive-library
+$(call trace-begin,$(ArchiveVerb))
 $(Echo) "$(ArchiveVerb) ($(ARName)) \"$(call ResultsPath,$(@))\""
 $(tool-create-archive-library)
+$(trace-end)
+endef
+
+# Generate the export map for a shared library from its export list.
+
+define generate-export-map
+$(call trace-begin,$(GenerateVerb))
+$(Echo) "$(GenerateVerb) \"$(call ResultsPath,$(@))\""
+$(tool-generate-export-map)
+$(trace-end)
 endef
 
 # Transform a set of objects into a shared library file.
 
 define link-shared-library
+$(call trace-begin,$(LinkVerb))
 $(Echo) "$(LinkVerb) ($(LDName)) \"$(call ResultsPath,$(@))\""
 $(tool-link-shared-library)
+$(trace-end)
 endef
 
 # Transform a set of objects and libraries into an executable program.
 
 define link-program
+$(call trace-begin,$(LinkVerb))
 $(Echo) "$(LinkVerb) ($(LDName)) \"$(call ResultsPath,$(@))\""
 $(tool-link-program)
+$(trace-end)
+endef
+
+# Package the split debug information for a program.
+
+define package-debug-info
+$(call trace-begin,$(PackageVerb))
+$(Echo) "$(PackageVerb) ($(DWPName)) \"$(call ResultsPath,$(@))\""
+$(tool-package-debug-info)
+$(trace-end)
 endef
 
 # Execute program, providing all required loader search paths.
 
 define execute-program
+$(call trace-begin,$(ExecuteVerb))
 $(Echo) "$(ExecuteVerb) \"$(call ResultsPath,$<)\""
-$(Verbose)export $(LoaderSearchPath)=$(subst $(Space),:,$(dir $(LDLIBS) $(RESLIBS)))$(addprefix :,$($(LoaderSearchPath))) && $(<) $($(<F)_ARGUMENTS)
+$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) && $(<) $($(<F)_ARGUMENTS)
+$(trace-end)
+endef
+
+# Execute program with its training arguments, if any, otherwise its
+# execution arguments, providing all required loader search paths.
+# Since the purpose of training is the profile data the program
+# writes, rather than its outcome, its exit status is ignored.
+
+define train-program
+$(call trace-begin,$(TrainVerb))
+$(Echo) "$(TrainVerb) \"$(call ResultsPath,$<)\""
+-$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) && $(<) $(if $(filter undefined,$(origin $(<F)_TRAINING_ARGUMENTS)),$($(<F)_ARGUMENTS),$($(<F)_TRAINING_ARGUMENTS))
+$(trace-end)
+endef
+
+# Profile program with its execution arguments using the profile tool,
+# '$(ProfileTool)', writing its folded call stacks, suitable for flame
+# graph tools, and its top-functions report alongside it.
+
+ProfileTool                    ?= perf
+
+ProgramProfileSuffix            = -profile
+
+define profile-program
+$(Echo) "$(ProfileVerb) ($(ProfileTool)) \"$(call ResultsPath,$<)\""
+$(call profile-program-$(ProfileTool),$(<)$(ProgramProfileSuffix))
+$(Quiet)cat "$(<)$(ProgramProfileSuffix).txt"
+endef
+
+# profile-program-perf <base>
+#
+# Sample the call stacks of the program, by frame pointer, into the
+# specified base path with a '.data' extension and report them.
+
+define profile-program-perf
+$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) && $(PERF) record $(PERFRECORDFLAGS) -o "$(1).data" -- $(<) $($(<F)_ARGUMENTS)
+$(Verbose)$(PERF) script -i "$(1).data" | $(call report-program-profile,perf,$(1))
+endef
+
+# profile-program-gprof <base>
+#
+# Run the program, instrumented for 'gprof', writing its call graph
+# profile data into the specified base path with a '.gmon.<pid>'
+# extension, and report it.
+
+define profile-program-gprof
+$(Verbose)$(RM) $(RMFLAGS) "$(1).gmon".*
+$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) GMON_OUT_PREFIX="$(1).gmon" && $(<) $($(<F)_ARGUMENTS)
+$(Verbose)$(GPROF) $(GPROFFLAGS) -b $(<) "$(1).gmon".* | $(call report-program-profile,gprof,$(1))
+endef
+
+# report-program-profile <format> <base>
+#
+# Generate, from the profile of the specified format on standard
+# input, the folded call stacks and the top-functions report, as JSON
+# and text, into the specified base path with '.folded', '.json' and
+# '.txt' extensions.
+
+report-program-profile          = $(MKPROFILEREPORT) $(MKPROFILEREPORTFLAGS) -f $(1) -p $(<F) -s "$(2).folded" -j "$(2).json" -o "$(2).txt"
+
+# The loader search paths required to execute a program, from its
+# library dependencies, ahead of any already in the environment.
+
+ProgramLoaderSearchPaths = $(subst $(Space),:,$(strip $(foreach library,$(LDLIBS) $(RESLIBS),$(call ToolLibraryPathArgumentHandler,$(library)))))$(addprefix :,$($(LoaderSearchPath)))
+
+# Merge the raw profile data written by instrumented programs into that
+# used for profile-guided optimization.
+
+define merge-profile
+$(call trace-begin,$(MergeVerb))
+$(Echo) "$(MergeVerb) \"$(call ResultsPath,$(ProfileDirectory))\""
+$(call tool-merge-profile,$(ProfileDirectory))
+$(trace-end)
+endef
+
+# Generate the interface digest for a shared library, only updating
+# it when it has changed such that dependents are only relinked when
+# the interface has, and its witness, the target, regardless.
+
+define update-interface-digest
+$(call trace-begin,Checking)
+$(Echo) "Checking interface \"$(call ResultsPath,$(basename $(@)))\""
+$(call tool-generate-interface-digest,$(basename $(@)).N)
+$(call move-if-change,$(basename $(@)).N,$(basename $(@)),$(@))
+$(trace-end)
+endef
+
+# Copy a multi-versioned object to its default variant, with the names
+# of its external functions suffixed as such.
+
+define rename-multiversion-default
+$(call trace-begin,$(GenerateVerb))
+$(Echo) "$(GenerateVerb) \"$(call ResultsPath,$(@))\""
+$(call tool-rename-multiversion-symbols,$<,$(@).N,default,$(MultiVersionTag))
+$(Verbose)mv -f "$(@).N" "$(@)"
+$(trace-end)
+endef
+
+# The language, 'c' or 'c++', as which a multi-versioned source, $<,
+# is compiled.
+
+MultiVersionLanguage = $(if $(filter %.c,$<),$(if $(TransformCAsCPlusPlus),c++,c),c++)
+
+# Transform a multi-versioned C or C++ file into its variant object
+# file for the instruction set architecture level, $*, with the names
+# of its external and weak functions suffixed by that level and with
+# its data bound to those of the default variant, such that only its
+# functions are its own. The object is compiled and renamed aside and
+# only then moved into place, such that an interrupted build never
+# leaves behind an unrenamed yet up-to-date object.
+
+define compile-multiversion-level
+$(call trace-begin,$(CompileVerb))
+$(Echo) "$(CompileVerb) ($(if $(filter c,$(MultiVersionLanguage)),$(CCName),$(CXXName))) \"$<\""
+$(call tool-compile-multiversion-level,$(MultiVersionLanguage),$(basename $(@)).s)
+$(call tool-assemble-multiversion-level,$(basename $(@)).s,$(@).N,$(MultiVersionObject))
+$(call tool-rename-multiversion-symbols,$(@).N,$(@).N.renamed,$*,$(MultiVersionTag),$(MultiVersionObject))
+$(Verbose)$(RM) $(RMFLAGS) "$(basename $(@)).s" "$(@).N"
+$(Verbose)mv -f "$(@).N.renamed" "$(@)"
+$(trace-end)
+endef
+
+# Generate the run-time dispatcher for the external functions of a
+# multi-versioned object.
+
+define generate-multiversion-dispatcher
+$(call trace-begin,$(GenerateVerb))
+$(Echo) "$(GenerateVerb) \"$(call ResultsPath,$(@))\""
+$(tool-generate-multiversion-dispatcher)
+$(trace-end)
+endef
+
+# Generate the tool chain fingerprint, only updating it when it has
+# changed such that objects are only remade when the tool chain has.
+
+define update-toolchain-fingerprint
+$(call trace-begin,Checking)
+$(Echo) "Checking tool chain fingerprint \"$(call ResultsPath,$(@))\""
+$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(@D)"
+$(call tool-generate-toolchain-fingerprint,$(@).N)
+$(call move-if-change,$(@).N,$(@))
+$(trace-end)
+endef
+
+# Record the profile tool for which objects and programs are
+# instrumented, only updating the record when it has changed.
+
+define update-profile-instrumentation
+$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(@D)"
+$(Verbose)test "`cat "$(@)" 2> /dev/null`" = "$(ProfileInstrumentation)" || echo "$(ProfileInstrumentation)" > "$(@)"
 endef
 
 #
@@ -493,6 +731,23 @@ CXXFLAGS_EnableShared_Y  = $(CXXPICFlag)
 $(call GenerateBuildPaths,%$(StaticObjectSuffix)): CCFLAGS  += $(CCFLAGS_EnableShared_$(EnableShared_Y))
 $(call GenerateBuildPaths,%$(StaticObjectSuffix)): CXXFLAGS += $(CXXFLAGS_EnableShared_$(EnableShared_Y))
 
+# Only add the hidden visibility flags for shared objects if
+# 'UseHiddenVisibility' is asserted, in which case only those symbols
+# explicitly given default visibility in the source are exported.
+
+UseHiddenVisibility_Y           = $(call IsYes,$(UseHiddenVisibility))
+
+CCFLAGS_UseHiddenVisibility_   := $(Null)
+CCFLAGS_UseHiddenVisibility_N  := $(CCFLAGS_UseHiddenVisibility_)
+CCFLAGS_UseHiddenVisibility_Y   = $(CCHiddenVisibilityFlag)
+
+CXXFLAGS_UseHiddenVisibility_  := $(Null)
+CXXFLAGS_UseHiddenVisibility_N := $(CXXFLAGS_UseHiddenVisibility_)
+CXXFLAGS_UseHiddenVisibility_Y  = $(CXXHiddenVisibilityFlag)
+
+$(call GenerateBuildPaths,%$(SharedObjectSuffix)): CCFLAGS  += $(CCFLAGS_UseHiddenVisibility_$(UseHiddenVisibility_Y))
+$(call GenerateBuildPaths,%$(SharedObjectSuffix)): CXXFLAGS += $(CXXFLAGS_UseHiddenVisibility_$(UseHiddenVisibility_Y))
+
 # Handle input source files in the makefile directory with output in the build directory.
 
 $(call GenerateBuildPaths,%$(SharedObjectSuffix) %$(StaticObjectSuffix)): %.c.i | $(DependDirectory) $(BuildDirectory)
@@ -630,6 +885,9 @@ prepare: recursive local-prepare
 ifeq ($(TargetTuple),$(HostTuple))
 .PHONY: execute local-execute
 execute: recursive local-execute
+
+.PHONY: train local-train
+train: recursive local-train
 endif
 
 # ARCHIVES and LIBRARIES are phony because they will never name a
@@ -642,7 +900,7 @@ endif
 # rule and do so at this stage such that dependencies can be generated
 # and specified as a goal for 'local-all'.
 
-TARGETS	+= $(ARCHIVES) $(LIBRARIES) $(PROGRAMS)
+TARGETS	+= $(ARCHIVES) $(LIBRARIES) $(PROGRAMS) $(BENCHMARKS) $(TESTS)
 
 # DEPEND_template <target>
 #
@@ -679,15 +937,21 @@ $(foreach target,$(TARGETS),$(foreach header,$($(target)_HEADERS),$(eval $(call
 
 HeaderTargets = $(HEADERS)
 $(HeaderTargets):
+	$(call trace-begin,Installing)
 	$(install-result)
+	$(trace-end)
 
 # Always include in the private 'local-all' target a command that'll
 # always succeed to avoid "make[n]: Nothing to be done for `all'." 
 # messages for make files that do not have an 'all' target with
 # commands.
+#
+# For make files with dependencies, that command merges them, once
+# all targets have been made, into the dependency database that
+# post.mak includes in lieu of each individual dependency file.
 
 local-all: $(TARGETS) $(DEPENDS) $(HEADERS)
-	$(Quiet)true
+	$(if $(DEPENDS),$(call UpdateDependDatabasePath,$(DependDatabasePath),$(DEPENDS)),$(Quiet)true)
 
 local-prepare: $(BuildDirectory) $(ResultDirectory) $(PrepareTargets) $(HEADERS)
 	$(Quiet)true
@@ -707,8 +971,10 @@ force:
 # 'makefile', with the current make command goals.
 
 define make-submakefile
+$(call trace-begin,Processing)
 $(Echo) "Processing \"$(call GenerateBuildRootEllipsedPath,$(if $(call IsAbsolutePath,$(1)),$(1),$(BuildCurrentDirectory)/$(1)))\""
 +$(Verbose)$(MAKE) -C "$(dir $(1))" -f "$(notdir $(1))" $(MAKECMDGOALS)
+$(trace-end)
 endef # make-submakefile
 
 # make-submakefile-target
@@ -769,6 +1035,64 @@ define ASSIGNMENT_template
 $($(1)$(2)): $(3) $(4) $($(1)_$(3))
 endef # ASSIGNMENT_template
 
+#
+# Multi-versioned object instantiation
+#
+
+# Instruction set architecture level variant objects are compiled
+# with the flags for that level. Since they depend on the object they
+# are a variant of, these are private such that it does not inherit
+# them. Dependencies are only generated for that object. Like that
+# object, its dispatcher is never link-time optimized, since it
+# declares the variants' functions with a prototype of its own.
+
+MultiVersionLevelFlags = $(MultiVersionFlags) $(call ToolMultiVersionLevelFlag,$*)
+
+# MULTIVERSION_OBJECT_template <source> <object>
+#
+# This template instantiates a template for making, from the specified
+# multi-versioned source and its specified object, the default and
+# instruction set architecture level variants of that object and the
+# run-time dispatcher source for their external functions.
+
+define MULTIVERSION_OBJECT_template
+$(2): CCFLAGS += $$(MultiVersionFlags)
+$(2): CXXFLAGS += $$(MultiVersionFlags)
+
+MultiVersionDefaultTargets += $$(call GenerateMultiVersionPaths,default,$(2))
+$$(call GenerateMultiVersionPaths,default,$(2)): $(2)
+
+MultiVersionDispatcherTargets += $$(call GenerateMultiVersionPaths,dispatch,$$(basename $(2)).c)
+$$(call GenerateMultiVersionPaths,dispatch,$$(basename $(2)).c): $(2)
+$$(call GenerateMultiVersionPaths,dispatch,$(2)): private CCFLAGS += $$(MultiVersionFlags)
+$$(call GenerateMultiVersionPaths,dispatch,$(2)): private CXXFLAGS += $$(MultiVersionFlags)
+
+$$(call GenerateMultiVersionPaths,default $$(MultiVersionLevels),$(2)): private MultiVersionTag := $$(notdir $$(basename $(2)))
+$$(call GenerateMultiVersionPaths,$$(MultiVersionLevels),$(2)): private MultiVersionObject := $(2)
+
+$$(call GenerateMultiVersionPaths,$$(MultiVersionLevels),$(2)): private CPPDependFlags :=
+$$(call GenerateMultiVersionPaths,$$(MultiVersionLevels),$(2)): private CCFLAGS += $$(MultiVersionLevelFlags)
+$$(call GenerateMultiVersionPaths,$$(MultiVersionLevels),$(2)): private CXXFLAGS += $$(MultiVersionLevelFlags)
+$$(call GenerateMultiVersionPaths,$$(MultiVersionLevels),$(2)): $$(call GenerateMultiVersionPaths,%,$(2)): $(1) $(2) | $(BuildDirectory)
+	$$(compile-multiversion-level)
+endef # MULTIVERSION_OBJECT_template
+
+# MULTIVERSION_template <target> <objects> <generator>
+#
+# This template instantiates a template for adding to the specified
+# objects of the specified target, generated with the specified object
+# path generator, the variants and dispatcher of each of the target
+# sources it lists in 'MULTIVERSION_SOURCES'. Those sources' objects,
+# listed in '<target>_MOBJECTS', are replaced by them when linking.
+
+define MULTIVERSION_template
+$(1)_MSOURCES := $$(if $$(MultiVersionLevels),$$(filter $$($(1)_MULTIVERSION_SOURCES),$$($(1)_SOURCES)))
+$(1)_MOBJECTS := $$(call $(3),$$($(1)_MSOURCES))
+$(1)$(2) += $$(call GenerateMultiVersionPaths,default $$(MultiVersionLevels) dispatch,$$($(1)_MOBJECTS))
+
+$$(foreach source,$$($(1)_MSOURCES),$$(eval $$(call MULTIVERSION_OBJECT_template,$$(source),$$(call $(3),$$(source)))))
+endef # MULTIVERSION_template
+
 #
 # Archive library target instantiation
 #
@@ -784,6 +1108,7 @@ ArchiveTargets = $(call GenerateArchiveLibraryPaths,$(ARCHIVES))
 define ARCHIVE_template
 SOURCES += $$($(1)_SOURCES)
 $(1)_SOBJECTS += $$(call GenerateStaticObjectPaths,$$($(1)_SOURCES))
+$$(eval $$(call MULTIVERSION_template,$(1),_SOBJECTS,GenerateStaticObjectPaths))
 $$($(1)_SOBJECTS): | $$(call HEADER_result,$$($(1)_HEADERS))
 $(1)_INCLUDES += $$(sort $$(dir $$($(1)_SOURCES)))
 OBJECTS += $$($(1)_SOBJECTS)
@@ -792,11 +1117,12 @@ $(1)_ARCHIVE := $(1)
 $(1)_STARGET := $$(call GenerateArchiveLibraryPaths,$(1))
 
 $(1): $$($(1)_STARGET)
-$$($(1)_STARGET): $$($(1)_SOBJECTS)
+$$($(1)_STARGET): | $$(filter-out $$($(1)_MOBJECTS),$$($(1)_SOBJECTS))
+$$($(1)_STARGET): ArchiveThin = $$(if $$($(1)_THIN),$$($(1)_THIN),$$(UseThinArchives))
 
 $(1)_GENERATION := $$(call GenerateGenerationPaths,$(1))
 GENERATIONS += $$($(1)_GENERATION)
-$$($(1)_GENERATION): $$($(1)_SOBJECTS)
+$$(call GenerateWitnessPaths,$$($(1)_GENERATION)): $$(filter-out $$($(1)_MOBJECTS),$$($(1)_SOBJECTS))
 $$($(1)_STARGET): $$($(1)_GENERATION)
 
 # These conditional assignments are per object.
@@ -832,6 +1158,7 @@ LibraryTargets = $(call GenerateSharedLibraryPaths,$(LIBRARIES))
 define LIBRARY_template
 SOURCES += $$($(1)_SOURCES)
 $(1)_DOBJECTS += $$(call GenerateSharedObjectPaths,$$($(1)_SOURCES))
+$$(eval $$(call MULTIVERSION_template,$(1),_DOBJECTS,GenerateSharedObjectPaths))
 $$($(1)_DOBJECTS): | $$(call HEADER_result,$$($(1)_HEADERS))
 $(1)_INCLUDES += $$(sort $$(dir $$($(1)_SOURCES)))
 OBJECTS += $$($(1)_DOBJECTS)
@@ -839,13 +1166,24 @@ OBJECTS += $$($(1)_DOBJECTS)
 $(1)_LIBRARY := $(1)
 $(1)_DTARGET := $$(call GenerateSharedLibraryPaths,$(1))
 
-$(1): $$($(1)_DTARGET)
-$$($(1)_DTARGET): $$($(1)_DOBJECTS)
-$$($(1)_DTARGET): $$($(1)_DEPLIBS)
+$(1)_ITARGET := $$(call GenerateSharedLibraryInterfacePaths,$$($(1)_DTARGET))
+
+$(1): $$($(1)_DTARGET) $$($(1)_ITARGET)
+$$($(1)_DTARGET): | $$(filter-out $$($(1)_MOBJECTS),$$($(1)_DOBJECTS))
+$$($(1)_DTARGET): $$(call GenerateDependLibraryPaths,$$($(1)_DEPLIBS))
+
+ifneq ($$($(1)_EXPORTS),)
+$(1)_EXPORTMAP := $$(call GenerateSharedLibraryExportMapPaths,$(1))
+ExportMapTargets += $$($(1)_EXPORTMAP)
+
+$$($(1)_EXPORTMAP): $$($(1)_EXPORTS) | $(BuildDirectory)
+$$($(1)_DTARGET): $$($(1)_EXPORTMAP)
+$$($(1)_DTARGET): LDFLAGS += $$(LDExportMapFlag)$$($(1)_EXPORTMAP)
+endif
 
 $(1)_GENERATION := $$(call GenerateGenerationPaths,$(1))
 GENERATIONS += $$($(1)_GENERATION)
-$$($(1)_GENERATION): $$($(1)_DOBJECTS)
+$$(call GenerateWitnessPaths,$$($(1)_GENERATION)): $$(filter-out $$($(1)_MOBJECTS),$$($(1)_DOBJECTS))
 $$($(1)_DTARGET): $$($(1)_GENERATION)
 
 # These conditional assignments are per object.
@@ -869,18 +1207,47 @@ $(foreach library,$(LIBRARIES),$(eval $(call LIBRARY_template,$(library))))
 
 $(LibraryTargets):
 	$(link-shared-library)
+
+# Only bind references to functions within a shared library to the
+# library itself, rather than allowing their interposition, if
+# 'UseSymbolicFunctions' is asserted. This is never done for programs,
+# where it is of no benefit.
+
+UseSymbolicFunctions_Y           = $(call IsYes,$(UseSymbolicFunctions))
+
+LDFLAGS_UseSymbolicFunctions_   := $(Null)
+LDFLAGS_UseSymbolicFunctions_N  := $(LDFLAGS_UseSymbolicFunctions_)
+LDFLAGS_UseSymbolicFunctions_Y   = $(LDSymbolicFunctionsFlag)
+
+$(LibraryTargets): LDFLAGS += $(LDFLAGS_UseSymbolicFunctions_$(UseSymbolicFunctions_Y))
+
+ifdef ExportMapTargets
+$(ExportMapTargets):
+	$(generate-export-map)
+endif
+
+LibraryInterfaceTargets = $(call GenerateSharedLibraryInterfacePaths,$(LibraryTargets))
 endif # LIBRARIES
 
 #
 # Program target instantiation
 #
 
-ifdef PROGRAMS
+ifneq ($(strip $(PROGRAMS) $(BENCHMARKS) $(TESTS)),)
 ProgramTargets = $(call GenerateProgramPaths,$(PROGRAMS))
+BenchmarkTargets = $(call GenerateProgramPaths,$(BENCHMARKS))
+TestTargets = $(call GenerateProgramPaths,$(TESTS))
 ifeq ($(TargetTuple),$(HostTuple))
 ExecuteTargets = $(addprefix execute-,$(PROGRAMS))
+TrainTargets = $(addprefix train-,$(PROGRAMS))
+ProfileTargets = $(addprefix profile-,$(PROGRAMS))
 endif
 
+# Program profiles are made alongside, though not as prerequisites of,
+# programs, so clean them by wildcard.
+
+CleanPaths += $(wildcard $(addsuffix $(ProgramProfileSuffix).*,$(ProgramTargets)))
+
 # PROGRAM_template <target>
 #
 # This template instantiates a template for making the specified
@@ -889,6 +1256,7 @@ endif
 define PROGRAM_template
 SOURCES += $$($(1)_SOURCES)
 $(1)_POBJECTS += $$(call GenerateStaticObjectPaths,$$($(1)_SOURCES))
+$$(eval $$(call MULTIVERSION_template,$(1),_POBJECTS,GenerateStaticObjectPaths))
 $$($(1)_POBJECTS): | $$(call HEADER_result,$$($(1)_HEADERS))
 $(1)_INCLUDES += $$(sort $$(dir $$($(1)_SOURCES)))
 OBJECTS += $$($(1)_POBJECTS)
@@ -897,17 +1265,29 @@ $(1)_PROGRAM := $(1)
 $(1)_PTARGET := $$(call GenerateProgramPaths,$(1))
 
 $(1): $$($(1)_PTARGET)
-$$($(1)_PTARGET): $$($(1)_POBJECTS)
-$$($(1)_PTARGET): $$($(1)_DEPLIBS)
+$$($(1)_PTARGET): | $$(filter-out $$($(1)_MOBJECTS),$$($(1)_POBJECTS))
+$$($(1)_PTARGET): $$(call GenerateDependLibraryPaths,$$($(1)_DEPLIBS))
 
 $(1)_GENERATION := $$(call GenerateGenerationPaths,$(1))
 GENERATIONS += $$($(1)_GENERATION)
-$$($(1)_GENERATION): $$($(1)_POBJECTS)
+$$(call GenerateWitnessPaths,$$($(1)_GENERATION)): $$(filter-out $$($(1)_MOBJECTS),$$($(1)_POBJECTS))
 $$($(1)_PTARGET): $$($(1)_GENERATION)
 
+ifeq ($(UseDebugInfoPackages_Y),Y)
+$(1)_DPTARGET := $$(addsuffix $(DebugPackageSuffix),$$($(1)_PTARGET))
+DebugPackageTargets += $$($(1)_DPTARGET)
+
+$(1): $$($(1)_DPTARGET)
+$$($(1)_DPTARGET): $$($(1)_PTARGET)
+endif
+
 ifeq ($(TargetTuple),$(HostTuple))
 $(1)_ETARGET := $(addprefix execute-,$(1))
 $$($(1)_ETARGET): $$($(1)_PTARGET)
+$(1)_TTARGET := $(addprefix train-,$(1))
+$$($(1)_TTARGET): $$($(1)_PTARGET)
+$(1)_FTARGET := $(addprefix profile-,$(1))
+$$($(1)_FTARGET): $$($(1)_PTARGET)
 endif
 
 # These conditional assignments are per object.
@@ -931,15 +1311,99 @@ ifeq ($(TargetTuple),$(HostTuple))
 # These conditional assignments are per target.
 $$(call ASSIGNMENT_template,$(1),_ETARGET,LDLIBS,+=)
 $$(call ASSIGNMENT_template,$(1),_ETARGET,RESLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_TTARGET,LDLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_TTARGET,RESLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_FTARGET,LDLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_FTARGET,RESLIBS,+=)
 endif
 
 endef # PROGRAM_template
 
 $(foreach program,$(PROGRAMS),$(eval $(call PROGRAM_template,$(program))))
 
-$(ProgramTargets):
+# BENCHMARK_template <target>
+#
+# This template instantiates a template for making the specified
+# benchmark target. A benchmark is made exactly as a program is but,
+# rather than being run once by its 'execute' target, is run
+# repeatedly and measured by its 'benchmark' target.
+
+define BENCHMARK_template
+$$(eval $$(call PROGRAM_template,$(1)))
+
+ifeq ($(TargetTuple),$(HostTuple))
+$(1)_BMTARGET := $(addprefix benchmark-,$(1))
+$$($(1)_BMTARGET): $$($(1)_PTARGET) | $(ResultDirectory)
+
+# These conditional assignments are per target.
+$$(call ASSIGNMENT_template,$(1),_BMTARGET,LDLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_BMTARGET,RESLIBS,+=)
+endif
+endef # BENCHMARK_template
+
+$(foreach benchmark,$(BENCHMARKS),$(eval $(call BENCHMARK_template,$(benchmark))))
+
+# TEST_template <target>
+#
+# This template instantiates a template for making the specified test
+# target. A test is made exactly as a program is but, rather than
+# being run by its 'execute' target, is run, with a timeout and its
+# output captured, by its 'test' target.
+
+define TEST_template
+$$(eval $$(call PROGRAM_template,$(1)))
+
+ifeq ($(TargetTuple),$(HostTuple))
+$(1)_TSTARGET := $(addprefix test-,$(1))
+$$($(1)_TSTARGET): $$($(1)_PTARGET) | $(ResultDirectory)
+
+# These conditional assignments are per target.
+$$(call ASSIGNMENT_template,$(1),_TSTARGET,LDLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_TSTARGET,RESLIBS,+=)
+endif
+endef # TEST_template
+
+$(foreach test,$(TESTS),$(eval $(call TEST_template,$(test))))
+
+$(ProgramTargets) $(BenchmarkTargets) $(TestTargets):
 	$(link-program)
 
+# LINK_VARIANT_template <target> <variant>
+#
+# This template instantiates a template for making the specified link
+# variant of the specified program target from the same objects,
+# alongside it as '<program>-<variant>'.
+
+define LINK_VARIANT_template
+$(1)_$(2)_VTARGET := $$($(1)_PTARGET)-$(2)
+$(1)_VTARGETS += $$($(1)_$(2)_VTARGET)
+LinkVariantTargets += $$($(1)_$(2)_VTARGET)
+
+$(1): $$($(1)_$(2)_VTARGET)
+$$($(1)_$(2)_VTARGET): | $$(filter-out $$($(1)_MOBJECTS),$$($(1)_POBJECTS))
+$$($(1)_$(2)_VTARGET): $$(call GenerateDependLibraryPaths,$$($(1)_DEPLIBS))
+$$($(1)_$(2)_VTARGET): $$($(1)_GENERATION)
+$$($(1)_$(2)_VTARGET): LDFLAGS += $$(LDFLAGS_LinkVariant_$(2))
+
+# These conditional assignments are per target.
+$$(call ASSIGNMENT_template,$(1),_$(2)_VTARGET,LDFLAGS,+=)
+$$(call ASSIGNMENT_template,$(1),_$(2)_VTARGET,DEPLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_$(2)_VTARGET,LDLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_$(2)_VTARGET,RESLIBS,+=)
+endef # LINK_VARIANT_template
+
+$(foreach program,$(PROGRAMS),$(foreach variant,$(filter $(LinkVariants),$($(program)_LINK_VARIANTS)),$(eval $(call LINK_VARIANT_template,$(program),$(variant)))))
+
+ifdef LinkVariantTargets
+$(LinkVariantTargets):
+	$(link-program)
+endif
+
+ifeq ($(UseDebugInfoPackages_Y),Y)
+$(DebugPackageTargets):
+	$(package-debug-info)
+endif
+
 ifeq ($(TargetTuple),$(HostTuple))
 
 .PHONY: local-execute $(ExecuteTargets)
@@ -949,19 +1413,53 @@ local-execute: $(ExecuteTargets)
 $(ExecuteTargets):
 	$(execute-program)
 
+.PHONY: local-train $(TrainTargets)
+
+local-train: $(TrainTargets)
+	$(Quiet)true
+
+$(TrainTargets):
+	$(train-program)
+
+.PHONY: $(ProfileTargets)
+
+$(ProfileTargets):
+	$(profile-program)
+
 endif
 
-endif # PROGRAMS
+endif # PROGRAMS BENCHMARKS TESTS
+
+ifdef MultiVersionDefaultTargets
+$(MultiVersionDefaultTargets):
+	$(rename-multiversion-default)
+
+$(MultiVersionDispatcherTargets):
+	$(generate-multiversion-dispatcher)
+endif
 
 PatchedDependPaths      = $(DEPENDS)
 BaseDependPaths         = $(call GenerateBaseDependNames,$(PatchedDependPaths))
 
 DependPaths             = $(BaseDependPaths) $(PatchedDependPaths)
 
+ifdef DEPENDS
+DependPaths             += $(DependDatabasePath)
+endif
+
 BuildPaths              += $(OBJECTS)
 BuildPaths		+= $(GENERATIONS)
+BuildPaths		+= $(call GenerateWitnessPaths,$(GENERATIONS))
+BuildPaths              += $(addsuffix $(SplitDebugSuffix),$(basename $(OBJECTS)))
+BuildPaths              += $(ExportMapTargets)
+BuildPaths              += $(MultiVersionDispatcherTargets)
 
 ResultPaths             += $(HeaderTargets) $(ArchiveTargets) $(LibraryTargets) $(ProgramTargets) $(ImageTargets)
+ResultPaths             += $(BenchmarkTargets) $(TestTargets)
+ResultPaths             += $(addsuffix $(DebugPackageSuffix),$(ProgramTargets) $(BenchmarkTargets) $(TestTargets))
+ResultPaths             += $(LibraryInterfaceTargets)
+ResultPaths             += $(call GenerateWitnessPaths,$(LibraryInterfaceTargets))
+ResultPaths             += $(LinkVariantTargets)
 
 # These are what post.mak will rely upon to include in all makefiles
 # that include post.mak.
@@ -1045,12 +1543,95 @@ $(BuildPaths): | $(BuildDirectory)
 
 $(ResultPaths): | $(ResultDirectory)
 
+#
+# Dependency database targets
+#
+
+# Should the dependency database be older than any dependency file
+# when post.mak includes it (for example, because a prior build was
+# interrupted), remake it such that make restarts with current
+# dependencies.
+
+ifdef DEPENDS
+$(DependDatabasePath): $(wildcard $(DEPENDS))
+	$(call UpdateDependDatabasePath,$(@),$(^),-f)
+endif
+
+#
+# Tool chain fingerprint targets
+#
+
+# When dependencies are pruned of system and tool chain headers, all
+# objects depend, instead, on the tool chain fingerprint. The
+# top-level make file checks (that is, forces) the fingerprint once
+# per build; otherwise, it is only made when it does not exist.
+
+ifeq ($(UsePrunedDependencies_Y),Y)
+$(OBJECTS): $(ToolchainFingerprintPath)
+
+$(ToolchainFingerprintPath): $(ToolchainFingerprintForce)
+	$(update-toolchain-fingerprint)
+endif
+
+#
+# Profile instrumentation targets
+#
+
+# When objects and programs are instrumented for a profile tool, all
+# objects depend on the record of that tool, only updated when it has
+# changed, such that switching tools remakes them, and the programs
+# linked from them, instrumented for the new one.
+
+ifneq ($(ProfileInstrumentation),)
+$(OBJECTS): $(ProfileInstrumentationPath)
+
+$(ProfileInstrumentationPath): force
+	$(update-profile-instrumentation)
+endif
+
+#
+# Profile-guided optimization targets
+#
+
+# The profile data is unique to the build tuple rather than to any one
+# make file and is, consequently, merged and cleaned for it as a
+# whole.
+
+.PHONY: profile-merge profile-clean
+
+profile-merge:
+	$(merge-profile)
+
+profile-clean:
+	$(Echo) "Cleaning \"$(call ResultsPath,$(ProfileDirectory))\""
+	-$(Verbose)$(RM) $(RMFLAGS) -r "$(ProfileDirectory)"
+
 #
 # Generation targets
 #
 
-$(GENERATIONS):
-	$(call UpdateGenerationPath,$(@))
+$(call GenerateWitnessPaths,$(GENERATIONS)): %$(WitnessSuffix):
+	$(call UpdateGenerationPath,$(*),$(^))
+
+$(GENERATIONS): %: %$(WitnessSuffix)
+	$(witnessed-result)
+
+#
+# Interface digest targets
+#
+# Since the interface digest of a shared library is depended upon by
+# dependents in other make files as well as made by the one making
+# the library, it is matched by pattern rather than by target, as is
+# its witness, which is kept rather than deleted as an intermediate.
+#
+
+.PRECIOUS: %$(SharedLibrarySuffix)$(SharedLibraryInterfaceSuffix)$(WitnessSuffix)
+
+%$(SharedLibrarySuffix)$(SharedLibraryInterfaceSuffix)$(WitnessSuffix): %$(SharedLibrarySuffix)
+	$(update-interface-digest)
+
+%$(SharedLibrarySuffix)$(SharedLibraryInterfaceSuffix): %$(SharedLibrarySuffix)$(SharedLibraryInterfaceSuffix)$(WitnessSuffix)
+	$(witnessed-result)
 
 #
 # Clean targets
@@ -1088,9 +1669,20 @@ local-distclean: clean
 	$(call remove-empty-directory-and-ancestors, $(DependDirectory))
 	$(call remove-empty-directory-and-ancestors, $(ResultDirectory))
 
+include post/rules/benchmark.mak
+include post/rules/build-trace.mak
+include post/rules/compile-profile.mak
+include post/rules/coverage.mak
+include post/rules/header-impact.mak
 include post/rules/help.mak
+include post/rules/include-analysis.mak
+include post/rules/link-compare.mak
 include post/rules/print.mak
 include post/rules/pretty.mak
+include post/rules/resource-report.mak
+include post/rules/size-report.mak
+include post/rules/startup-benchmark.mak
+include post/rules/test.mak
 include post/rules/tps.mak
 
 include target/tools/$(ToolTuple)/rules.mak
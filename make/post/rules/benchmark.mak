@@ -0,0 +1,124 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make macros, rules and targets for running
+#      benchmark programs and comparing them against a baseline.
+#
+#      Benchmarks, listed in 'BENCHMARKS', are made exactly as
+#      programs are, from '<benchmark>_SOURCES' and the like. The
+#      recursive target 'benchmark' makes each and then, using
+#      '$(MKBENCHMARK)', runs each '$(BenchmarkRuns)' times, after
+#      '$(BenchmarkWarmups)' unmeasured runs, with its execution
+#      arguments, if any, from '<benchmark>_ARGUMENTS', pinned to
+#      '$(BenchmarkCPUs)', if any, reporting its latency statistics
+#      as both JSON and text to '<benchmark>-benchmark.{json,txt}' in
+#      the results directory. Runs that fail are excluded from those
+#      statistics and, should any, the benchmark fails.
+#
+#      When the baseline, '<benchmark>_BASELINE' if set, otherwise
+#      '<benchmark>-benchmark-baseline.json' in
+#      '$(BenchmarkBaselineDirectory)', by default 'baselines/' and
+#      the build tuple under the source directory such that it may be
+#      committed alongside the benchmark, exists, the median latency is compared against it and, should
+#      it have increased by more than
+#      '$(BenchmarkRegressionThreshold)' percent, the benchmark fails.
+#      When 'BenchmarkUpdateBaseline' is asserted, the report instead
+#      becomes the new baseline.
+#
+#      Benchmarks are only run when the host and target tuples are
+#      the same.
+#
+
+BenchmarkUpdateBaseline_Y        = $(call IsYes,$(BenchmarkUpdateBaseline))
+
+BenchmarkRuns                   ?= 10
+BenchmarkWarmups                ?= 1
+BenchmarkCPUs                   ?=
+BenchmarkRegressionThreshold    ?= 5
+BenchmarkBaselineDirectory      ?= $(CURDIR)/baselines/$(ConditionalBuildTuple)
+
+GenerateBenchmarkPaths           = $(call Slashify,$(ResultDirectory))$(1)-benchmark$(2)
+
+# BenchmarkBaselinePath <benchmark>
+#
+# The baseline report path of the specified benchmark.
+
+BenchmarkBaselinePath            = $(if $($(1)_BASELINE),$($(1)_BASELINE),$(call Slashify,$(BenchmarkBaselineDirectory))$(1)-benchmark-baseline.json)
+
+# BenchmarkBaselineFlags <benchmark>
+#
+# The baseline comparison flags for the specified benchmark, if it has
+# a baseline and the baseline is not being updated.
+
+BenchmarkBaselineFlags_          = $(if $(wildcard $(call BenchmarkBaselinePath,$(1))),-b "$(call BenchmarkBaselinePath,$(1))" -t $(BenchmarkRegressionThreshold))
+BenchmarkBaselineFlags_N         = $(BenchmarkBaselineFlags_)
+BenchmarkBaselineFlags_Y         = $(Null)
+
+BenchmarkBaselineFlags           = $(call BenchmarkBaselineFlags_$(BenchmarkUpdateBaseline_Y),$(1))
+
+# update-benchmark-baseline <benchmark>
+#
+# Copy the report of the specified benchmark to its baseline, when the
+# baseline is being updated.
+
+update-benchmark-baseline_       = $(Null)
+update-benchmark-baseline_N      = $(update-benchmark-baseline_)
+define update-benchmark-baseline_Y
+$(Echo) "Updating baseline \"$(call GenerateBuildRootEllipsedPath,$(call BenchmarkBaselinePath,$(1)))\""
+$(Verbose)$(INSTALL) $(INSTALLFLAGS) -d "$(dir $(call BenchmarkBaselinePath,$(1)))"
+$(Verbose)$(INSTALL) $(INSTALLFLAGS) -m 644 "$(call GenerateBenchmarkPaths,$(1),.json)" "$(call BenchmarkBaselinePath,$(1))"
+endef
+
+update-benchmark-baseline        = $(call update-benchmark-baseline_$(BenchmarkUpdateBaseline_Y),$(1))
+
+# make-benchmark <benchmark>
+#
+# Run the specified benchmark, providing all required loader search
+# paths, and compare it against its baseline, if any, failing on a
+# failed run or a regression, though only after its report is shown.
+
+define make-benchmark
+$(Echo) "Benchmarking \"$(call ResultsPath,$($(1)_PTARGET))\""
+$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) && \
+    $(MKBENCHMARK) $(MKBENCHMARKFLAGS) \
+        -n $(BenchmarkRuns) \
+        -w $(BenchmarkWarmups) \
+        $(if $(strip $(BenchmarkCPUs)),-c "$(strip $(BenchmarkCPUs))") \
+        $(call BenchmarkBaselineFlags,$(1)) \
+        -j "$(call GenerateBenchmarkPaths,$(1),.json)" \
+        -o "$(call GenerateBenchmarkPaths,$(1),.txt)" \
+        "$(1)=$($(1)_PTARGET) $($(1)_ARGUMENTS)"; \
+    status=$$?; \
+    if [ -f "$(call GenerateBenchmarkPaths,$(1),.txt)" ]; then cat "$(call GenerateBenchmarkPaths,$(1),.txt)"; fi; \
+    exit $$status
+$(call update-benchmark-baseline,$(1))
+endef
+
+ifeq ($(TargetTuple),$(HostTuple))
+BenchmarkRunTargets              = $(addprefix benchmark-,$(BENCHMARKS))
+endif
+
+.PHONY: benchmark local-benchmark $(BenchmarkRunTargets)
+
+benchmark: recursive local-benchmark
+
+local-benchmark: $(BenchmarkRunTargets)
+	$(Quiet)true
+
+$(BenchmarkRunTargets): benchmark-%:
+	$(call make-benchmark,$(*))
@@ -0,0 +1,82 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make macros, rules and targets for tracing
+#      the timeline of every build step.
+#
+#      When 'BuildTrace' is asserted, each build step, that is, each
+#      compile, depend, archive, link, generate, check, header install
+#      and sub-make dispatch, appends, to '$(BuildTraceRecordPath)', a
+#      begin record before it and an end record after it, each with a
+#      time stamp, the process identifier of the make running it, the
+#      directory and the target.
+#
+#      The target 'build-trace-reset' removes any previous records,
+#      and the target 'build-trace', using '$(MKBUILDTRACE)', pairs
+#      them into a single Chrome trace event timeline, viewable with
+#      'chrome://tracing' or Perfetto, at '$(BuildTracePath)'.
+#
+
+BuildTrace_Y                     = $(call IsYes,$(BuildTrace))
+
+BuildTracePath                   = $(call Slashify,$(ResultBuildDirectory))build-trace.json
+
+# trace-record <phase> <category>
+#
+# Append a build trace record of the specified phase, 'B' for begin
+# or 'E' for end, and category for the current target. Since tracing
+# is purely diagnostic, failing to append a record is not an error.
+
+trace-record_                    = $(Null)
+trace-record_N                   = $(trace-record_)
+
+define trace-record_Y
+$(Quiet)printf '%s\t%s\t%s\t%s\t%s\t%s\n' "$(1)" "`$(TIMESTAMP)`" "$$PPID" "$(2)" "$(CURDIR)" "$(@)" >> "$(BuildTraceRecordPath)" 2> /dev/null || true
+endef
+
+# trace-begin <category>
+#
+# Append a build trace begin record of the specified category for the
+# current target.
+
+trace-begin                      = $(call trace-record_$(BuildTrace_Y),B,$(1))
+
+# trace-end
+#
+# Append a build trace end record for the current target.
+
+trace-end                        = $(call trace-record_$(BuildTrace_Y),E)
+
+# make-build-trace <records> <trace>
+#
+# Generate, from the specified build trace records, the Chrome trace
+# event timeline at the specified path.
+
+define make-build-trace
+$(Echo) "$(GenerateVerb) \"$(call GenerateBuildRootEllipsedPath,$(2))\""
+$(Verbose)$(MKBUILDTRACE) $(MKBUILDTRACEFLAGS) -r "$(BuildRoot)" -o "$(2)" "$(1)"
+endef
+
+.PHONY: build-trace build-trace-reset
+
+build-trace-reset:
+	$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(ResultBuildDirectory)"
+	$(Verbose)$(RM) $(RMFLAGS) "$(BuildTraceRecordPath)"
+
+build-trace:
+	$(call make-build-trace,$(BuildTraceRecordPath),$(BuildTracePath))
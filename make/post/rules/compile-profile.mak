@@ -0,0 +1,75 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make rules and targets for reporting where
+#      compile time is spent.
+#
+#      The target 'compile-profile' gathers the compile-time traces,
+#      written alongside each object when 'UseCompileTimeTrace' is
+#      asserted, for the current build tuple from the hidden build
+#      directories at and below the current directory and, using
+#      '$(MKCOMPILEPROFILE)', reports the objects that took longest to
+#      compile and, summed across them, the headers most expensive
+#      to parse, template instantiations most expensive to perform,
+#      functions most expensive to optimize and compiler phases most
+#      expensive to run, to the extent the tool chain attributes time
+#      to each.
+#
+#      Each, up to '$(CompileProfileLimit)' of them, is ranked and the
+#      report is written as both JSON and text to
+#      '$(CompileProfilePaths)'. The compile time of each object is
+#      also written to '$(CompileProfileTimingPath)', in a form
+#      suitable for '$(HeaderImpactTimingPaths)'.
+#
+
+CompileProfileLimit             ?= 25
+
+CompileProfileJsonPath           = $(call Slashify,$(ResultDirectory))compile-profile.json
+CompileProfileTextPath           = $(call Slashify,$(ResultDirectory))compile-profile.txt
+CompileProfileTimingPath         = $(call Slashify,$(ResultDirectory))compile-profile.times
+CompileProfilePaths              = $(CompileProfileJsonPath) $(CompileProfileTextPath)
+
+# Compile-time traces are made alongside, though not as prerequisites
+# of, objects, so clean them by wildcard.
+
+CleanPaths                      += $(wildcard $(call Slashify,$(BuildDirectory))*$(CompileTimeTraceSuffix))
+
+# make-compile-profile <root> <json> <text> <timing>
+#
+# Generate, from all of the compile-time traces for the current build
+# tuple at and below the current directory, the compile profile
+# report relative to the specified root, writing it as JSON and text
+# and the per-object compile times to the specified paths.
+
+define make-compile-profile
+$(Echo) "Reporting compile profile for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose)find "$(CURDIR)" -path "*/$(BuildBaseDirectory)/*/$(ConditionalBuildTuple)/*$(CompileTimeTraceSuffix)" -type f | \
+    $(MKCOMPILEPROFILE) $(MKCOMPILEPROFILEFLAGS) \
+        -s "$(CompileTimeTraceSuffix)" \
+        -r "$(1)" \
+        -j "$(2)" \
+        -o "$(3)" \
+        -t "$(4)" \
+        -l $(CompileProfileLimit)
+$(Quiet)cat "$(3)"
+endef
+
+.PHONY: compile-profile
+
+compile-profile: | $(ResultDirectory)
+	$(call make-compile-profile,$(BuildRoot),$(CompileProfileJsonPath),$(CompileProfileTextPath),$(CompileProfileTimingPath))
@@ -0,0 +1,126 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make macros, rules and targets for collecting
+#      and reporting code coverage.
+#
+#      Once objects made with 'UseCodeCoverage' asserted have been run,
+#      as by the 'execute' or 'test' targets, the recursive target
+#      'coverage-collect' processes, using '$(MKCOVERAGE)' and the tool
+#      chain '$(GCOV)', the coverage data of each object into an lcov
+#      tracefile alongside it, each as a make job of its own. Since
+#      each tracefile depends on its coverage data, only that which has
+#      changed since it was last collected is reprocessed. The
+#      tracefiles of each directory are then merged into
+#      '$(CoverageInfoPath)' or, for a directory with no coverage data,
+#      any such tracefile from a previous collection is removed.
+#
+#      Since subdirectories are made as prerequisites of 'recursive',
+#      with a jobserver-aware make, the coverage data of all
+#      directories, not just that of each, is processed as concurrent
+#      jobs.
+#
+#      The target 'coverage-report', using '$(MKCOVERAGEREPORT)',
+#      merges those of all directories beneath this one into a single
+#      report, written as an lcov tracefile, JSON, text and HTML to
+#      '$(CoverageReportPaths)'. The 'coverage' action makes it at the
+#      project root, once collection across the tree is complete.
+#
+
+CoverageDataSuffix               = .gcda
+CoverageNotesSuffix              = .gcno
+CoverageInfoSuffix               = .info
+
+CoverageInfoPath                 = $(call Slashify,$(ResultDirectory))coverage.info
+
+CoverageReportInfoPath           = $(call Slashify,$(ResultDirectory))coverage-report.info
+CoverageReportJsonPath           = $(call Slashify,$(ResultDirectory))coverage-report.json
+CoverageReportTextPath           = $(call Slashify,$(ResultDirectory))coverage-report.txt
+CoverageReportHtmlDirectory      = $(call Slashify,$(ResultDirectory))coverage-report
+CoverageReportPaths              = $(CoverageReportInfoPath) $(CoverageReportJsonPath) $(CoverageReportTextPath) $(CoverageReportHtmlDirectory)
+
+# Coverage data is only present for those objects that have been run.
+
+CoverageDataPaths                = $(wildcard $(sort $(addsuffix $(CoverageDataSuffix),$(basename $(OBJECTS)))))
+CoverageInfoPaths                = $(CoverageDataPaths:$(CoverageDataSuffix)=$(CoverageInfoSuffix))
+
+CleanPaths                      += $(wildcard $(call Slashify,$(BuildDirectory))*$(CoverageDataSuffix))
+CleanPaths                      += $(wildcard $(call Slashify,$(BuildDirectory))*$(CoverageNotesSuffix))
+CleanPaths                      += $(wildcard $(call Slashify,$(BuildDirectory))*$(CoverageInfoSuffix))
+
+# make-coverage-info
+#
+# Process the coverage data prerequisite into the lcov tracefile
+# target.
+
+define make-coverage-info
+$(Echo) "Collecting coverage \"$(call ResultsPath,$(<))\""
+$(Verbose)$(MKCOVERAGE) $(MKCOVERAGEFLAGS) \
+    -g "$(GCOV)" \
+    -r "$(BuildRoot)" \
+    -d "$(CURDIR)" \
+    -o "$(@)" \
+    "$(<)"
+endef
+
+# make-coverage-merge
+#
+# Merge the lcov tracefile prerequisites into the lcov tracefile
+# target.
+
+define make-coverage-merge
+$(Echo) "Merging coverage \"$(call ResultsPath,$(@))\""
+$(Verbose)$(MKCOVERAGEREPORT) $(MKCOVERAGEREPORTFLAGS) \
+    -r "$(BuildRoot)" \
+    -l "$(@)" \
+    $(foreach path,$(^),"$(path)")
+endef
+
+# make-coverage-report
+#
+# Merge the directory lcov tracefiles beneath this directory into the
+# coverage report.
+
+define make-coverage-report
+$(Echo) "Reporting coverage for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose)$(RM) $(RMFLAGS) -r "$(CoverageReportHtmlDirectory)"
+$(Verbose)$(MKCOVERAGEREPORT) $(MKCOVERAGEREPORTFLAGS) \
+    -r "$(BuildRoot)" \
+    -l "$(CoverageReportInfoPath)" \
+    -j "$(CoverageReportJsonPath)" \
+    -o "$(CoverageReportTextPath)" \
+    -h "$(CoverageReportHtmlDirectory)" \
+    $$(find "$(ResultDirectory)" -name "$(notdir $(CoverageInfoPath))" -type f)
+$(Quiet)cat "$(CoverageReportTextPath)"
+endef
+
+.PHONY: coverage-collect local-coverage-collect coverage-report
+
+coverage-collect: recursive local-coverage-collect
+
+local-coverage-collect: $(if $(CoverageInfoPaths),$(CoverageInfoPath))
+	$(if $(CoverageInfoPaths),$(Quiet)true,-$(Verbose)$(RM) $(RMFLAGS) "$(CoverageInfoPath)")
+
+$(CoverageInfoPath): $(CoverageInfoPaths) | $(ResultDirectory)
+	$(make-coverage-merge)
+
+$(call GenerateBuildPaths,%$(CoverageInfoSuffix)): $(call GenerateBuildPaths,%$(CoverageDataSuffix))
+	$(make-coverage-info)
+
+coverage-report: | $(ResultDirectory)
+	$(make-coverage-report)
@@ -0,0 +1,65 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+
+##
+#    @file
+#      This file defines make rules and targets for reporting the
+#      rebuild impact of project headers.
+#
+#      The target 'header-impact' gathers the dependency files for the
+#      current build tuple from the hidden dependency directories at
+#      and below the current directory and, using '$(MKHEADERIMPACT)',
+#      reports, for each project header, the number of objects that
+#      depend on it, the total compile time of those objects, when
+#      timing data in '$(HeaderImpactTimingPaths)' is available, and
+#      the include chain responsible for it.
+#
+#      The headers, up to '$(HeaderImpactLimit)' of them, are ranked
+#      and the report is written as both JSON and text to
+#      '$(HeaderImpactPaths)'.
+#
+
+HeaderImpactLimit               ?= 25
+HeaderImpactTimingPaths         ?=
+
+HeaderImpactJsonPath             = $(call Slashify,$(ResultDirectory))header-impact.json
+HeaderImpactTextPath             = $(call Slashify,$(ResultDirectory))header-impact.txt
+HeaderImpactPaths                = $(HeaderImpactJsonPath) $(HeaderImpactTextPath)
+
+# make-header-impact <root> <json> <text>
+#
+# Generate, from all of the dependency files for the current build
+# tuple at and below the current directory, the header impact report
+# relative to the specified root, writing it as JSON and text to the
+# specified paths.
+
+define make-header-impact
+$(Echo) "Reporting header impact for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose)find "$(CURDIR)" -path "*/$(DependBaseDirectory)/*/$(ConditionalBuildTuple)/*$(BaseDependSuffix)" -type f | \
+    $(MKHEADERIMPACT) $(MKHEADERIMPACTFLAGS) \
+        -r "$(1)" \
+        -j "$(2)" \
+        -o "$(3)" \
+        -l $(HeaderImpactLimit) \
+        $(foreach path,$(wildcard $(HeaderImpactTimingPaths)),-t "$(path)")
+$(Quiet)cat "$(3)"
+endef
+
+.PHONY: header-impact
+
+header-impact: | $(ResultDirectory)
+	$(call make-header-impact,$(BuildRoot),$(HeaderImpactJsonPath),$(HeaderImpactTextPath))
@@ -0,0 +1,83 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+
+##
+#    @file
+#      This file defines make rules and targets for analyzing the
+#      include directories of archive library, shared library,
+#      program, benchmark, and test targets.
+#
+#      The recursive target 'include-analysis' reports, for each such
+#      target, which of the include directories from '$(INCLUDES)' and
+#      '<target>_INCLUDES' resolve no headers for that target, using
+#      the dependency files from a previous build and
+#      '$(MKINCLUDEANALYSIS)'. Directories implicitly added for the
+#      target's sources are marked as such.
+#
+#      For each target, the reduced set of explicit include
+#      directories, those in use, is also generated as a make file
+#      fragment assigning '<target>_INCLUDES' in
+#      '$(ResultDirectory)', from which the target's make file may be
+#      updated.
+#
+#      When '$(IncludeAnalysisEnforce)' is asserted, the target fails
+#      if any target has unused explicit include directories, allowing
+#      search paths to be kept minimal. The reduced set is generated
+#      for adoption by the make file author rather than applied to the
+#      build since dependency files from a previous build cannot
+#      account for inclusions added since.
+#
+
+IncludeAnalysisEnforce          ?= No
+
+IncludeAnalysisEnforce_Y         = $(call IsYes,$(IncludeAnalysisEnforce))
+
+IncludeAnalysisFlags_IncludeAnalysisEnforce_  := $(Null)
+IncludeAnalysisFlags_IncludeAnalysisEnforce_N := $(IncludeAnalysisFlags_IncludeAnalysisEnforce_)
+IncludeAnalysisFlags_IncludeAnalysisEnforce_Y := -e
+IncludeAnalysisFlags             = $(IncludeAnalysisFlags_IncludeAnalysisEnforce_$(IncludeAnalysisEnforce_Y))
+
+IncludeAnalysisTargets           = $(addprefix include-analysis-,$(ARCHIVES) $(LIBRARIES) $(PROGRAMS) $(BENCHMARKS) $(TESTS))
+
+IncludeAnalysisReducedSuffix     = .includes.mak
+
+# make-include-analysis <target>
+#
+# Analyze, from its existing dependency files, which of the include
+# directories for the specified target resolve no headers, generating
+# the reduced set of those that do.
+
+define make-include-analysis
+$(Echo) "Analyzing includes for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))/$(1)\""
+$(Verbose)$(MKINCLUDEANALYSIS) $(MKINCLUDEANALYSISFLAGS) $(IncludeAnalysisFlags) \
+    -n "$(1)" \
+    -C "$(CURDIR)" \
+    -o "$(call Slashify,$(ResultDirectory))$(1)$(IncludeAnalysisReducedSuffix)" \
+    $(foreach include,$(INCLUDES) $($(1)_INCLUDES),-I "$(include)") \
+    $(foreach include,$(sort $(dir $($(1)_SOURCES))),-i "$(include)") \
+    $(wildcard $($(1)_DEPENDS))
+endef
+
+.PHONY: include-analysis local-include-analysis $(IncludeAnalysisTargets)
+
+include-analysis: recursive local-include-analysis
+
+local-include-analysis: $(IncludeAnalysisTargets)
+	$(Quiet)true
+
+$(IncludeAnalysisTargets): include-analysis-%: | $(ResultDirectory)
+	$(call make-include-analysis,$(*))
@@ -0,0 +1,66 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+
+##
+#    @file
+#      This file defines make rules and targets for comparing the link
+#      time of shared library and program targets across linkers.
+#
+#      The recursive target 'link-compare' relinks each such target,
+#      once per linker in '$(LinkCompareLinkers)' that is available,
+#      reporting the elapsed time of each, and then relinks it with
+#      the configured linker. Each time includes that of the make
+#      invocation that performs the link, which is constant across
+#      linkers.
+#
+
+LinkCompareLinkers              ?= bfd gold lld mold
+
+LinkCompareTargets               = $(addprefix link-compare-,$(LIBRARIES) $(PROGRAMS))
+
+# make-link-compare <path> <dependent libraries>
+#
+# Relink the specified target path with each available linker,
+# reporting the elapsed time of each, and then relink it with the
+# configured linker. The dependent libraries, which are already up to
+# date, are not reconsidered.
+
+define make-link-compare
+$(Echo) "Comparing linkers for \"$(call ResultsPath,$(1))\""
++$(Verbose)for linker in $(LinkCompareLinkers); do \
+    if [ ! -x "$(ToolBinDir)/$(CROSS_COMPILE)ld.$${linker}" ]; then \
+        printf "    %-8s %12s\n" "$${linker}" "unavailable"; \
+        continue; \
+    fi; \
+    $(RM) $(RMFLAGS) "$(1)"; \
+    start=`$(TIMESTAMP)`; \
+    $(MAKE) --no-print-directory -f "$(call FirstMakefile)" UseLinker=$${linker} $(addprefix -o ,$(2)) "$(1)" > /dev/null || exit 1; \
+    end=`$(TIMESTAMP)`; \
+    echo "$${start} $${end}" | awk -v linker="$${linker}" '{ printf("    %-8s %10.3f s\n", linker, $$2 - $$1) }'; \
+done
++$(Verbose)$(RM) $(RMFLAGS) "$(1)" && $(MAKE) --no-print-directory -f "$(call FirstMakefile)" $(addprefix -o ,$(2)) "$(1)" > /dev/null
+endef
+
+.PHONY: link-compare local-link-compare $(LinkCompareTargets)
+
+link-compare: recursive local-link-compare
+
+local-link-compare: $(LinkCompareTargets)
+	$(Quiet)true
+
+$(LinkCompareTargets): link-compare-%: %
+	$(call make-link-compare,$(or $($(*)_PTARGET),$($(*)_DTARGET)),$($(*)_DEPLIBS))
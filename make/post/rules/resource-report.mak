@@ -0,0 +1,78 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make macros, rules and targets for accounting
+#      for and reporting the resources used by compiles and links.
+#
+#      When 'ResourceAccounting' is asserted, each compile and link
+#      command is run by '$(MKRESOURCEACCOUNT)', which appends its
+#      peak resident set size and its user, system and wall time to
+#      '$(ResourceLedgerPath)'.
+#
+#      The target 'resource-ledger-reset' removes any previous ledger,
+#      and the target 'resource-report', using '$(MKRESOURCEREPORT)',
+#      reports the compiles and links, up to '$(ResourceReportLimit)'
+#      of each, with the largest peak resident set size, writing it
+#      as both JSON and text to '$(ResourceReportPaths)'.
+#
+
+ResourceAccounting_Y             = $(call IsYes,$(ResourceAccounting))
+
+ResourceReportLimit             ?= 25
+
+ResourceReportJsonPath           = $(call Slashify,$(ResultDirectory))resource-report.json
+ResourceReportTextPath           = $(call Slashify,$(ResultDirectory))resource-report.txt
+ResourceReportPaths              = $(ResourceReportJsonPath) $(ResourceReportTextPath)
+
+# ResourceAccount <category>
+#
+# The command prefix, used by the tool chain compile and link
+# commands, that accounts for their resources, for the current target
+# and specified category, when resource accounting is asserted.
+
+ResourceAccount_                 = $(Null)
+ResourceAccount_N                = $(ResourceAccount_)
+ResourceAccount_Y                = $(MKRESOURCEACCOUNT) $(MKRESOURCEACCOUNTFLAGS) -l "$(ResourceLedgerPath)" -c $(1) -t "$(abspath $(@))" --$(Space)
+
+ResourceAccount                  = $(call ResourceAccount_$(ResourceAccounting_Y),$(1))
+
+# make-resource-report <root> <ledger> <json> <text>
+#
+# Generate, from the specified resource ledger, the resource report
+# relative to the specified root, writing it as JSON and text to the
+# specified paths.
+
+define make-resource-report
+$(Echo) "Reporting resources for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose)$(MKRESOURCEREPORT) $(MKRESOURCEREPORTFLAGS) \
+    -r "$(1)" \
+    -j "$(3)" \
+    -o "$(4)" \
+    -l $(ResourceReportLimit) \
+    "$(2)"
+$(Quiet)cat "$(4)"
+endef
+
+.PHONY: resource-ledger-reset resource-report
+
+resource-ledger-reset:
+	$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(ResultBuildDirectory)"
+	$(Verbose)$(RM) $(RMFLAGS) "$(ResourceLedgerPath)"
+
+resource-report: | $(ResultDirectory)
+	$(call make-resource-report,$(BuildRoot),$(ResourceLedgerPath),$(ResourceReportJsonPath),$(ResourceReportTextPath))
@@ -0,0 +1,69 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make rules and targets for reporting the
+#      section sizes of objects, archives, shared libraries, programs,
+#      benchmarks, tests and program link variants.
+#
+#      The recursive target 'size-report' makes the archive, shared
+#      library, program, benchmark, test and link variant targets and
+#      then, using '$(MKSIZEREPORT)', reports the text, data and bss
+#      section sizes of each and, once each, of their objects, along with the change in their totals since
+#      the previous report, writing it as both JSON and text to
+#      '$(SizeReportPaths)'.
+#
+
+SizeReportJsonPath               = $(call Slashify,$(ResultDirectory))size-report.json
+SizeReportTextPath               = $(call Slashify,$(ResultDirectory))size-report.txt
+SizeReportPaths                  = $(SizeReportJsonPath) $(SizeReportTextPath)
+
+SizeReportTargets                = $(ArchiveTargets) $(LibraryTargets) $(ProgramTargets) $(BenchmarkTargets) $(TestTargets) $(LinkVariantTargets)
+
+# make-size-report <root> <json> <text>
+#
+# Generate the size report for the objects, archives, shared
+# libraries, programs, benchmarks, tests and link variants of the
+# current make file, relative to the specified root, writing it as JSON
+# and text to the specified paths. Objects shared among targets are
+# reported just once.
+
+define make-size-report
+$(Echo) "Reporting sizes for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose){ \
+    $(foreach path,$(sort $(OBJECTS)),echo "object $(abspath $(path))";) \
+    $(foreach path,$(ArchiveTargets),echo "archive $(path)";) \
+    $(foreach path,$(LibraryTargets),echo "library $(path)";) \
+    $(foreach path,$(ProgramTargets),echo "program $(path)";) \
+    $(foreach path,$(BenchmarkTargets),echo "benchmark $(path)";) \
+    $(foreach path,$(TestTargets),echo "test $(path)";) \
+    $(foreach path,$(LinkVariantTargets),echo "variant $(path)";) \
+    true; \
+} | $(MKSIZEREPORT) $(MKSIZEREPORTFLAGS) \
+        -s "$(SECTIONSIZE)" \
+        -r "$(1)" \
+        -j "$(2)" \
+        -o "$(3)"
+$(Quiet)cat "$(3)"
+endef
+
+.PHONY: size-report local-size-report
+
+size-report: recursive local-size-report
+
+local-size-report: $(SizeReportTargets) | $(ResultDirectory)
+	$(call make-size-report,$(BuildRoot),$(SizeReportJsonPath),$(SizeReportTextPath))
@@ -0,0 +1,111 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make rules and targets for benchmarking the
+#      startup latency of programs and their link variants.
+#
+#      The recursive target 'startup-benchmark' makes each program
+#      and its link variants, if any, from '<program>_LINK_VARIANTS'
+#      and then, using '$(MKBENCHMARK)', runs each
+#      '$(StartupBenchmarkRuns)' times with its startup arguments, if
+#      any, otherwise its execution arguments, reporting its
+#      exec-to-exit latency percentiles as both JSON and text to
+#      '<program>-startup-benchmark.{json,txt}' in the results
+#      directory.
+#
+#      A run fails when the program is terminated by a signal or exits
+#      with a status other than one of its accepted statuses, from
+#      '<program>_STARTUP_STATUSES', if any, otherwise zero. Failed
+#      runs are excluded from the percentiles and, should any, the
+#      benchmark fails, though only after its report is shown.
+#
+#      Programs are only benchmarked when the host and target tuples
+#      are the same.
+#
+
+StartupBenchmarkRuns            ?= 100
+StartupBenchmarkWarmups         ?= 5
+
+
+GenerateStartupBenchmarkPaths    = $(call Slashify,$(ResultDirectory))$(1)-startup-benchmark$(2)
+
+# StartupBenchmarkArguments <program>
+#
+# The startup arguments of the specified program, if any, otherwise
+# its execution arguments.
+
+StartupBenchmarkArguments        = $(if $(filter undefined,$(origin $(1)_STARTUP_ARGUMENTS)),$($(1)_ARGUMENTS),$($(1)_STARTUP_ARGUMENTS))
+
+# StartupBenchmarkStatuses <program>
+#
+# The comma-separated exit statuses of the specified program that its
+# startup runs accept as success, if any, otherwise zero.
+
+StartupBenchmarkStatuses         = $(subst $(Space),$(Comma),$(or $(strip $($(1)_STARTUP_STATUSES)),0))
+
+# make-startup-benchmark <program>
+#
+# Benchmark the startup latency of the specified program and its link
+# variants, providing all required loader search paths, failing on a
+# failed run, though only after its report is shown.
+
+define make-startup-benchmark
+$(Echo) "Benchmarking startup of \"$(call ResultsPath,$($(1)_PTARGET))\""
+$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) && \
+    $(MKBENCHMARK) $(MKBENCHMARKFLAGS) \
+        -n $(StartupBenchmarkRuns) \
+        -w $(StartupBenchmarkWarmups) \
+        -s $(call StartupBenchmarkStatuses,$(1)) \
+        -j "$(call GenerateStartupBenchmarkPaths,$(1),.json)" \
+        -o "$(call GenerateStartupBenchmarkPaths,$(1),.txt)" \
+        $(foreach target,$($(1)_PTARGET) $($(1)_VTARGETS),"$(notdir $(target))=$(target) $(call StartupBenchmarkArguments,$(1))"); \
+    status=$$?; \
+    if [ -f "$(call GenerateStartupBenchmarkPaths,$(1),.txt)" ]; then cat "$(call GenerateStartupBenchmarkPaths,$(1),.txt)"; fi; \
+    exit $$status
+endef
+
+# STARTUP_BENCHMARK_template <program>
+#
+# This template instantiates a template for benchmarking the startup
+# latency of the specified program target and its link variants.
+
+define STARTUP_BENCHMARK_template
+$(1)_BTARGET := startup-benchmark-$(1)
+
+$$($(1)_BTARGET): $$($(1)_PTARGET) $$($(1)_VTARGETS) | $(ResultDirectory)
+
+# These conditional assignments are per target.
+$$(call ASSIGNMENT_template,$(1),_BTARGET,LDLIBS,+=)
+$$(call ASSIGNMENT_template,$(1),_BTARGET,RESLIBS,+=)
+endef # STARTUP_BENCHMARK_template
+
+ifeq ($(TargetTuple),$(HostTuple))
+StartupBenchmarkTargets          = $(addprefix startup-benchmark-,$(PROGRAMS))
+
+$(foreach program,$(PROGRAMS),$(eval $(call STARTUP_BENCHMARK_template,$(program))))
+endif
+
+.PHONY: startup-benchmark local-startup-benchmark $(StartupBenchmarkTargets)
+
+startup-benchmark: recursive local-startup-benchmark
+
+local-startup-benchmark: $(StartupBenchmarkTargets)
+	$(Quiet)true
+
+$(StartupBenchmarkTargets): startup-benchmark-%:
+	$(call make-startup-benchmark,$(*))
@@ -0,0 +1,166 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines make macros, rules and targets for running
+#      tests and reporting their results.
+#
+#      Tests, listed in 'TESTS', are made exactly as programs are,
+#      from '<test>_SOURCES' and the like. The recursive target 'test'
+#      makes each and then, using '$(MKTESTRUN)', runs each as a make
+#      job of its own, with its execution arguments, if any, from
+#      '<test>_ARGUMENTS', and its timeout, in seconds, from
+#      '<test>_TIMEOUT', if set, otherwise '$(TestTimeout)', capturing
+#      its output to '<test>-test.log' in the results directory.
+#
+#      Only the shard '$(TestShardIndex)' of '$(TestShardCount)' of
+#      the tests is run, as selected and ordered by '$(MKTESTPLAN)',
+#      longest first by their durations in '$(TestDurationsPath)', so
+#      that the longest tests are started earliest. Tests are assigned
+#      to shards by a hash of their path relative to the build root,
+#      such that shards are balanced across the whole tree rather
+#      than within each directory.
+#
+#      Once all have run, using '$(MKTESTREPORT)', their results are
+#      reported as JUnit XML, JSON and text to '$(TestReportPaths)',
+#      their durations are recorded to '$(TestDurationsPath)' and,
+#      should any test not have passed, the target fails. Directories
+#      with none of the tests to run remove any such report from a
+#      previous run.
+#
+#      Since subdirectories are made as prerequisites of 'recursive',
+#      with a jobserver-aware make, the tests of all directories, not
+#      just those of each, run as concurrent jobs.
+#
+#      The target 'test-summary', using '$(MKTESTREPORT)', merges the
+#      reports of all directories beneath this one into a single
+#      report, with a suite per directory, written as JUnit XML, JSON
+#      and text to '$(TestSummaryPaths)' and, should any test in them
+#      not have passed, fails.
+#
+#      Tests are only run when the host and target tuples are the
+#      same.
+#
+
+TestTimeout                     ?= 300
+TestShardIndex                  ?= 0
+TestShardCount                  ?= 1
+
+GenerateTestPaths                = $(call Slashify,$(ResultDirectory))$(1)-test$(2)
+
+TestDurationsPath                = $(call Slashify,$(ResultDirectory))test-durations
+
+TestReportXmlPath                = $(call Slashify,$(ResultDirectory))test-report.xml
+TestReportJsonPath               = $(call Slashify,$(ResultDirectory))test-report.json
+TestReportTextPath               = $(call Slashify,$(ResultDirectory))test-report.txt
+TestReportPaths                  = $(TestReportXmlPath) $(TestReportJsonPath) $(TestReportTextPath)
+
+TestSummaryXmlPath               = $(call Slashify,$(ResultDirectory))test-summary.xml
+TestSummaryJsonPath              = $(call Slashify,$(ResultDirectory))test-summary.json
+TestSummaryTextPath              = $(call Slashify,$(ResultDirectory))test-summary.txt
+TestSummaryPaths                 = $(TestSummaryXmlPath) $(TestSummaryJsonPath) $(TestSummaryTextPath)
+
+TestSuite                        = $(patsubst $(call Slashify,$(BuildRoot))%,%,$(CURDIR))
+
+# The suite by which tests are assigned to shards, empty rather than
+# absolute at the build root, such that it is the same on every
+# machine.
+
+TestShardSuite                   = $(call Deslashify,$(patsubst $(call Slashify,$(BuildRoot))%,%,$(call Slashify,$(CURDIR))))
+
+# TestTimeoutFor <test>
+#
+# The timeout, in seconds, of the specified test.
+
+TestTimeoutFor                   = $(if $($(1)_TIMEOUT),$($(1)_TIMEOUT),$(TestTimeout))
+
+# make-test <test>
+#
+# Run the specified test, providing all required loader search paths,
+# recording, rather than failing on, its outcome.
+
+define make-test
+$(Echo) "Testing \"$(call ResultsPath,$($(1)_PTARGET))\""
+$(Verbose)export $(LoaderSearchPath)=$(ProgramLoaderSearchPaths) && \
+    $(MKTESTRUN) $(MKTESTRUNFLAGS) \
+        -n "$(1)" \
+        -l "$(call GenerateTestPaths,$(1),.log)" \
+        -r "$(call GenerateTestPaths,$(1),.result)" \
+        -t $(call TestTimeoutFor,$(1)) \
+        -- $($(1)_PTARGET) $($(1)_ARGUMENTS)
+endef
+
+# make-test-report <test> ...
+#
+# Report the results of the specified tests, failing should any of
+# them not have passed, though only after the report is shown.
+
+define make-test-report
+$(Echo) "Reporting tests for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose)$(MKTESTREPORT) $(MKTESTREPORTFLAGS) \
+    -s "$(TestSuite)" \
+    -x "$(TestReportXmlPath)" \
+    -j "$(TestReportJsonPath)" \
+    -o "$(TestReportTextPath)" \
+    -d "$(TestDurationsPath)" \
+    $(foreach test,$(1),"$(call GenerateTestPaths,$(test),.result)"); \
+    status=$$?; \
+    cat "$(TestReportTextPath)"; \
+    exit $$status
+endef
+
+# make-test-summary
+#
+# Merge the directory test reports beneath this directory into the
+# test summary, failing should any test in them not have passed,
+# though only after the summary is shown.
+
+define make-test-summary
+$(Echo) "Summarizing tests for \"$(call GenerateBuildRootEllipsedPath,$(CURDIR))\""
+$(Verbose)$(MKTESTREPORT) $(MKTESTREPORTFLAGS) -m \
+    -x "$(TestSummaryXmlPath)" \
+    -j "$(TestSummaryJsonPath)" \
+    -o "$(TestSummaryTextPath)" \
+    $$(find "$(ResultDirectory)" -name "$(notdir $(TestReportJsonPath))" -type f); \
+    status=$$?; \
+    cat "$(TestSummaryTextPath)"; \
+    exit $$status
+endef
+
+# The test plan, the shard of tests to run in the order to run them,
+# is only made, which requires the durations history, when testing.
+
+ifeq ($(TargetTuple),$(HostTuple))
+TestRunTargets                   = $(addprefix test-,$(TESTS))
+
+ifneq ($(and $(strip $(TESTS)),$(filter test local-test,$(MAKECMDGOALS))),)
+TestPlan                        := $(shell $(MKTESTPLAN) $(MKTESTPLANFLAGS) -d "$(TestDurationsPath)" -s "$(TestShardSuite)" -i $(TestShardIndex) -c $(TestShardCount) $(TESTS))
+endif
+endif
+
+.PHONY: test local-test test-summary $(TestRunTargets)
+
+test: recursive local-test
+
+local-test: $(addprefix test-,$(TestPlan))
+	$(if $(TestPlan),$(call make-test-report,$(TestPlan)),-$(Verbose)$(RM) $(RMFLAGS) $(TestReportPaths))
+
+test-summary: | $(ResultDirectory)
+	$(make-test-summary)
+
+$(TestRunTargets): test-%:
+	$(call make-test,$(*))
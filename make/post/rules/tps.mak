@@ -40,6 +40,30 @@ ifneq ($(PackageName),)
 local-license: $(PackageLicenseFile)
 	$(Quiet)true
 
+# Remove the trees this build linked from the expansion store, though
+# not the store entries themselves, which other builds may share, on
+# clean.
+
+.PHONY: clean-package-expansions
+local-clean: clean-package-expansions
+
+clean-package-expansions:
+	-$(Verbose)if [ -f "$(PackageExpansionLinksPath)" ]; then \
+	    while read path; do $(RM) $(RMFLAGS) -r "$$path"; done < "$(PackageExpansionLinksPath)"; \
+	fi
+	-$(Verbose)$(RM) $(RMFLAGS) "$(PackageExpansionLinksPath)"
+
+# Remove all but the current expanded and patched tree of the package
+# from the expansion store, which is otherwise never pruned. Builds
+# sharing the store with a different package version or patch set
+# expand and patch theirs anew.
+
+.PHONY: prune-package-expansions
+
+prune-package-expansions:
+	$(Echo) "Pruning expansions of \"$(PackageName)\" from \"$(call GenerateBuildRootEllipsedPath,$(PackageExpansionStore))\""
+	-$(Verbose)$(RM) $(RMFLAGS) -r $(filter-out $(call _GeneratePackageExpansionPath,$(PackageExpansionKey)),$(PackageExpansionPaths))
+
 #
 # Third-party software snapshot/replay targets.
 #
@@ -54,35 +78,62 @@ local-license: $(PackageLicenseFile)
 
 ifneq ($(PackageBuildMode),$(_PackageBuildModeDefault))
 
+# Evaluate the snapshot key and compression, each of which requires a
+# shell, and the existing snapshot just once.
+
+PackageSnapshotKey                := $(PackageSnapshotKey)
+PackageSnapshotCompression        := $(PackageSnapshotCompression)
+PackageSnapshotExistingPath       := $(PackageSnapshotExistingPath)
+
 # Create, if necessary, the snapshot archive directory.
 
 $(PackageSnapshotDir):
 	$(create-directory-result)
 
-# Snapshot a build from the temporary installation area.
+# Snapshot a build from the temporary installation area, unless a
+# snapshot of identical content already exists, with either
+# compression.
 
+ifeq ($(PackageSnapshotExistingPath),)
 .PHONY: snapshot
 snapshot: $(PackageSnapshotPath)
+else
+.PHONY: snapshot
+snapshot:
+	$(Echo) "Snapshot \"$(PackageSnapshotExistingPath)\" is up to date"
+endif # ifeq ($(PackageSnapshotExistingPath),)
 
-# Archive the temporary installation area to a snapshot file.
+# Archive the temporary installation area to a snapshot file, by way
+# of a temporary file such that a snapshot store shared by concurrent
+# builds never holds a partial snapshot.
 
 $(PackageSnapshotPath): stage | $(PackageSnapshotDir) $(ResultDirectory)
 	$(Echo) "Saving snapshot to \"$(@)\""
-	$(Verbose)$(RM) $(RMFLAGS) "$(@)"
-	$(Verbose)tar -C $(ResultDirectory) --bzip2 -cf "$(@)" .
-	$(Verbose)chmod a-w "$(@)"
+	$(Verbose)$(RM) $(RMFLAGS) "$(@).N"
+	$(Verbose)tar -C $(ResultDirectory) --exclude="./$(notdir $(PackageSnapshotStampPath))" $(PackageSnapshotTarFlags) -cf "$(@).N" .
+	$(Verbose)chmod a-w "$(@).N"
+	$(Verbose)mv -f "$(@).N" "$(@)"
+	$(Verbose)echo "$(@F)" > "$(PackageSnapshotStampPath)"
+
+# Replay a snapshot file, of identical content, to the temporary
+# installation area, unless that snapshot was the last replayed to,
+# or made from, it.
 
-# Replay a snapshot file to the temporary installation area.
-ifeq ($(wildcard $(PackageSnapshotPath)),)
+ifeq ($(PackageSnapshotExistingPath),)
 .PHONY: replay
 replay: snapshot
 else
 .PHONY: replay
 replay: | $(ResultDirectory)
-	$(Echo) "Replaying snapshot from \"$(PackageSnapshotPath)\""
-	$(Echo) "Replaying snapshot to \"$(call GenerateBuildRootEllipsedPath,$(ResultDirectory))\""
-	$(Verbose)tar -C $(ResultDirectory) --bzip2 -xf $(PackageSnapshotPath)
-endif # ifeq ($(wildcard $(PackageSnapshotPath)),)
+	$(Verbose)if [ "`cat "$(PackageSnapshotStampPath)" 2> /dev/null`" = "$(notdir $(PackageSnapshotExistingPath))" ]; then \
+	    echo "Snapshot \"$(PackageSnapshotExistingPath)\" is already replayed"; \
+	else \
+	    echo "Replaying snapshot from \"$(PackageSnapshotExistingPath)\""; \
+	    echo "Replaying snapshot to \"$(call GenerateBuildRootEllipsedPath,$(ResultDirectory))\""; \
+	    tar -C $(ResultDirectory) $(PackageSnapshotExpandFlags) -xf "$(PackageSnapshotExistingPath)" && \
+	    echo "$(notdir $(PackageSnapshotExistingPath))" > "$(PackageSnapshotStampPath)"; \
+	fi
+endif # ifeq ($(PackageSnapshotExistingPath),)
 endif # ifneq ($(PackageBuildMode),$(_PackageBuildModeDefault))
 else
 local-license:
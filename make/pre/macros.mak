@@ -258,6 +258,18 @@ GenerateTargetDependPaths               = $(addprefix $(call Slashify,$(TargetDe
 
 GenerateDependPaths                     = $(addprefix $(call Slashify,$(DependDirectory)),$(notdir $(1)))
 
+# DependDatabasePath
+#
+# Scope: Private
+#
+# The path, rooted in the default (that is, host or target, depending
+# on the value of BuildHostSpecialized) dependency directory, of the
+# database into which all of the dependencies in that directory are
+# merged and deduplicated.
+
+DependDatabaseName                     := $(call GenerateHiddenNames,database)
+DependDatabasePath                      = $(call GenerateDependPaths,$(DependDatabaseName))
+
 ##
 ## Intermediate Build Results
 ##
@@ -328,6 +340,57 @@ ResultHostBuildDirectory                = $(call GenerateUnconditionalHostBuildQ
 ResultTargetBuildDirectory              = $(call GenerateUnconditionalTargetBuildQualifiedDirectory,$(ResultBaseDirectory))
 ResultBuildDirectory                    = $(call GenerateUnconditionalBuildQualifiedDirectory,$(ResultBaseDirectory))
 
+# ToolchainFingerprintPath
+#
+# Scope: Private
+#
+# The path, unique to the build tuple, of the fingerprint of the tool
+# chain compilers and the system headers they search by default.
+
+ToolchainFingerprintName               := $(call GenerateHiddenNames,toolchain-fingerprint)
+ToolchainFingerprintPath                = $(call Slashify,$(ResultBuildDirectory))$(ToolchainFingerprintName)
+
+# ProfileInstrumentationPath
+#
+# Scope: Private
+#
+# The path, unique to the build tuple, of the record of the profile
+# tool for which objects and programs are instrumented, if any.
+
+ProfileInstrumentationName             := $(call GenerateHiddenNames,profile-instrumentation)
+ProfileInstrumentationPath              = $(call Slashify,$(ResultBuildDirectory))$(ProfileInstrumentationName)
+
+# ProfileDirectory
+#
+# Scope: Private
+#
+# The directory, unique to the build tuple, in which profile-guided
+# optimization profile data is written by instrumented programs and
+# from which it is read when optimizing.
+
+ProfileDirectoryName                   := $(call GenerateHiddenNames,profile)
+ProfileDirectory                        = $(call Slashify,$(ResultBuildDirectory))$(ProfileDirectoryName)
+
+# BuildTraceRecordPath
+#
+# Scope: Private
+#
+# The path, unique to the build tuple, to which each build step
+# appends its begin and end records when build tracing is asserted.
+
+BuildTraceRecordName                   := $(call GenerateHiddenNames,build-trace)
+BuildTraceRecordPath                    = $(call Slashify,$(ResultBuildDirectory))$(BuildTraceRecordName)
+
+# ResourceLedgerPath
+#
+# Scope: Private
+#
+# The path, unique to the build tuple, to which each compile and link
+# appends the resources it used when resource accounting is asserted.
+
+ResourceLedgerName                     := $(call GenerateHiddenNames,resource-ledger)
+ResourceLedgerPath                      = $(call Slashify,$(ResultBuildDirectory))$(ResourceLedgerName)
+
 # GenerateHostResultSubdirectory <subdirectory>
 #
 # Generates the name of a subdirectory, rooted in the host result directory.
@@ -346,7 +409,7 @@ GenerateTargetResultSubdirectory        = $(call Deslashify,$(call Slashify,$(Re
 # is, host or target, building on the value of BuildHostSpecialized)
 # result directory.
 
-GenerateResultSubdirectory              = $(call Deslashify,$(call Slashify,$(ResultBuildDirectory))$(subst $(call Slashify,$(call CanonicalizePath,$(BuildRoot))),,$(1)))
+GenerateResultSubdirectory              = $(call Deslashify,$(call Slashify,$(ResultBuildDirectory))$(subst $(call Slashify,$(call CanonicalizePath,$(BuildRoot))),,$(call Slashify,$(1))))
 
 # GenerateHostResultPaths <subdirectory> <paths>
 #
@@ -578,6 +641,16 @@ GenerateTargetStaticObjectPaths         = $(call GenerateTargetBuildPaths,$(notd
 
 GenerateStaticObjectPaths               = $(call GenerateBuildPaths,$(notdir $(call GenerateStaticObjectNames,$(1))))
 
+# GenerateMultiVersionPaths <variants> <paths>
+#
+# Scope: Private
+#
+# Generates the path(s) of the specified multi-versioning variant(s),
+# for example, instruction set architecture levels, of the specified
+# object path(s), by appending each variant to the base name of each.
+
+GenerateMultiVersionPaths               = $(foreach variant,$(1),$(foreach path,$(2),$(basename $(path))-$(variant)$(suffix $(path))))
+
 # GenerateLibraryNames <extension> <names>
 #
 # Generates a library name(s) by concatenating a predefined library
@@ -749,6 +822,37 @@ GenerateTargetSharedLibraryResultPaths  = $(call GenerateTargetResultPaths,$(1),
 
 GenerateSharedLibraryResultPaths        = $(call GenerateResultPaths,$(1),$(call GenerateSharedLibraryNames,$(2)))
 
+# GenerateSharedLibraryInterfacePaths <paths>
+#
+# Generates the interface digest path(s), the paths of the files
+# listing the symbols each exports, alongside the specified shared
+# library path(s).
+
+GenerateSharedLibraryInterfacePaths     = $(addsuffix $(SharedLibraryInterfaceSuffix),$(1))
+
+# GenerateSharedLibraryExportMapPaths <names>
+#
+# Scope: Private
+#
+# Generates the export map build path(s), the paths of the files,
+# generated from the export list of each of the specified shared
+# library name(s), that the linker uses to restrict the symbols the
+# library exports.
+
+GenerateSharedLibraryExportMapPaths     = $(call GenerateBuildPaths,$(addsuffix $(SharedLibraryExportMapSuffix),$(call GenerateHiddenNames,$(1))))
+
+# GenerateDependLibraryPaths <paths>
+#
+# Scope: Private
+#
+# Generates the path(s) on which a target depends for the specified
+# library dependency path(s). Shared library paths are mapped to
+# their interface digest paths such that dependents only relink when
+# the symbols a shared library exports change rather than whenever
+# it does. All other paths are passed through unchanged.
+
+GenerateDependLibraryPaths              = $(foreach path,$(1),$(if $(filter %$(SharedLibrarySuffix),$(path)),$(call GenerateSharedLibraryInterfacePaths,$(path)),$(path)))
+
 ##
 ## Programs
 ##
@@ -826,6 +930,14 @@ GenerateImageSrecPaths                  = $(call GenerateResultPaths,,$(call Gen
 ## current generation number of a program, image, archive or library
 ## build.
 ##
+## A generation file holds a content digest of the member objects of
+## its target and its modification time only changes when that
+## digest does. Consequently, a target relinks only when the contents
+## of one or more of its member objects actually change rather than
+## whenever they are merely remade. Its witness, alongside it, is
+## instead updated whenever the digest is checked, such that make
+## considers the generation current even when the digest is unchanged.
+##
 
 #
 # GenerateGenerationNames <prefixes>
@@ -872,3 +984,39 @@ GenerateTargetGenerationPaths           = $(call GenerateTargetBuildPaths,$(call
 # archive or library build.
 
 GenerateGenerationPaths                 = $(call GenerateBuildPaths,$(call GenerateGenerationNames,$(1)))
+
+#
+# GenerateWitnessPaths <paths>
+#
+# Scope: Private
+#
+# Generates the witness path(s), the paths of the files updated
+# whenever the specified file path(s), only themselves updated when
+# their contents change, are checked, alongside them.
+
+GenerateWitnessPaths                    = $(addsuffix $(WitnessSuffix),$(1))
+
+#
+# GenerationMembers
+#
+# Scope: Private
+#
+# In the context of a target recipe, expands to the member objects of
+# the target which, since they are order-only prerequisites of it
+# with its generation file standing in for them as a normal
+# prerequisite, are not otherwise available from the normal
+# prerequisites.
+
+GenerationMembers                       = $(filter $(OBJECTS),$(|))
+
+#
+# GenerationChangedMembers
+#
+# Scope: Private
+#
+# In the context of a target recipe, expands to a shell command
+# substitution yielding those member objects of the target newer than
+# it or, should it not exist, all of them, standing in for '$(?)' for
+# targets, such as archives, updated with only their changed members.
+
+GenerationChangedMembers                = `test -f "$(@)" && find $(GenerationMembers) -newer "$(@)" || echo $(GenerationMembers)`
@@ -33,11 +33,18 @@ LinkerDescriptorSuffix          = .lkf
 
 SharedLibrarySuffix             = .so
 SharedLibraryMapSuffix          = .map
+SharedLibraryInterfaceSuffix    = .abi
+SharedLibraryExportMapSuffix    = -exports
 
 ProgramPrefix                   =
 ProgramSuffix                   =
 ProgramMapSuffix                = .map
 
+SplitDebugSuffix                = .dwo
+DebugPackageSuffix              = .dwp
+
+WitnessSuffix                   = .witness
+
 ImageSuffix                     = .elf
 ImageMapSuffix                  = .map
 ImageBinSuffix                  = .bin
@@ -72,16 +72,109 @@ PackageVersion                    ?= $(if $(_PackageHasThirdPartyReadMePath_Y),$
 PackagePatchDir                    = $(call _GeneratePackagePaths,$(PackageName).patches)
 PackagePatchPaths                  = $(sort $(wildcard $(PackagePatchDir)/*.patch*))
 
-PackageSnapshotDir                 = $(call Deslashify,$(CURDIR)/snapshots/$(ConditionalBuildTuple))
+# Snapshots are content-addressed, keyed by the package name, version,
+# patch set and build tuple, such that a snapshot is only made once for
+# identical content and a snapshot store may be shared, by setting
+# 'PackageSnapshotStore', across products.
 
-PackageSnapshotFile                = $(PackageName)-snapshot.tar.bz2
+PackageSnapshotStore              ?= $(CURDIR)/snapshots
+PackageSnapshotDir                 = $(call Deslashify,$(PackageSnapshotStore)/$(ConditionalBuildTuple))
+
+PackageSnapshotKey                 = $(shell { printf '%s\n' "$(PackageName)" "$(PackageVersion)" "$(ConditionalBuildTuple)" $(notdir $(PackagePatchPaths)); cat $(PackagePatchPaths) < /dev/null; } | $(CKSUM) | $(SED) $(SEDFLAGS) -e 's/[[:space:]]\{1,\}/-/g' -e 's/-$$//')
+
+# Snapshots are compressed with multi-threaded zstd where it is
+# available, otherwise with bzip2.
+
+PackageSnapshotCompression        ?= $(if $(shell command -v $(firstword $(ZSTD)) 2> /dev/null),zstd,bzip2)
+
+_PackageSnapshotSuffix_zstd       := .tar.zst
+_PackageSnapshotSuffix_bzip2      := .tar.bz2
+
+_PackageSnapshotTarFlags_zstd      = --use-compress-program="$(ZSTD) $(ZSTDFLAGS)"
+_PackageSnapshotTarFlags_bzip2    := --bzip2
+
+PackageSnapshotTarFlags            = $(_PackageSnapshotTarFlags_$(PackageSnapshotCompression))
+
+PackageSnapshotName                = $(PackageName)-snapshot-$(PackageSnapshotKey)
+PackageSnapshotFile                = $(PackageSnapshotName)$(_PackageSnapshotSuffix_$(PackageSnapshotCompression))
 PackageSnapshotPath                = $(call Slashify,$(PackageSnapshotDir))$(PackageSnapshotFile)
+
+# An existing snapshot of identical content may have been made with
+# either compression, whichever the host now prefers, and is replayed
+# from the first of these that exists, decompressed according to its
+# own type. Snapshots made before they were content-addressed record
+# neither the package version nor its patches and, since they cannot
+# be known to be of identical content, are never replayed but, rather,
+# made anew as keyed snapshots.
+
+PackageSnapshotExistingPath        = $(firstword $(wildcard $(addprefix $(call Slashify,$(PackageSnapshotDir))$(PackageSnapshotName),$(_PackageSnapshotSuffix_zstd) $(_PackageSnapshotSuffix_bzip2))))
+
+_PackageSnapshotExpandFlags.zst    = --use-compress-program="$(ZSTDEXPANDER)"
+_PackageSnapshotExpandFlags.bz2    = --use-compress-program="$(BZIP2EXPANDER)"
+
+PackageSnapshotExpandFlags         = $(_PackageSnapshotExpandFlags$(suffix $(PackageSnapshotExistingPath)))
+
+# The name of the snapshot last replayed to, or made from, the
+# temporary installation area.
+
+PackageSnapshotStampPath           = $(call Slashify,$(ResultDirectory)).snapshot-key
 PackageDefaultGoal                 = $(PackageBuildMode)
 
+# Expanded and patched package trees are cached, keyed by the contents
+# of the package archive and, in order, of its patches and by the
+# patch arguments, such that a package is only expanded and patched
+# once and then shared, by 'link-tree', among build tuples and, by
+# setting 'PackageExpansionStore', products. Since other builds may
+# share the store, only the trees this build linked from it are
+# removed on clean, as recorded in 'PackageExpansionLinksPath', and
+# the trees that each change of the package version or patches adds
+# to the store are only removed from it by 'prune-package-expansions'.
+
+PackageExpansionStore             ?= $(CURDIR)/expansions
+
+PackageArchivePath                 = $(call _GeneratePackagePaths,$(PackageArchive))
+
+PackageExpansionKey                = $(shell { printf '%s\n' "$(PackagePatchArgs)"; for path in "$(PackageArchivePath)" $(PackagePatchPaths); do $(CKSUM) < "$$path"; done; } | $(CKSUM) | $(SED) $(SEDFLAGS) -e 's/[[:space:]]\{1,\}/-/g' -e 's/-$$//')
+
+_GeneratePackageExpansionPath      = $(call Slashify,$(PackageExpansionStore))$(PackageName)-expansion-$(1)
+
+PackageExpansionPaths              = $(wildcard $(call _GeneratePackageExpansionPath,*))
+
+PackageExpansionLinksPath          = $(call Slashify,$(BuildDirectory)).$(PackageName)-expansion-links
+
+# _expand-and-patch-package-to-store <key> <scratch directory>
+#
+# Expand and patch the package archive in the specified scratch
+# directory and then move it into the expansion store under the
+# specified key. Should a concurrent build already have, the move
+# fails, since the key is then a directory that is not empty, and the
+# scratch directory is removed instead.
+#
+define _expand-and-patch-package-to-store
+$(Verbose)$(RM) $(RMFLAGS) -r "$(2)"
+$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(2)"
+$(call expand-archive,$(PackageArchivePath),$(2))
+$(call patch-directory,$(call Slashify,$(2))$(notdir $(@)),$(PackagePatchArgs),$(PackagePatchPaths))
+$(Verbose)$(MVDIR) "$(2)" "$(call _GeneratePackageExpansionPath,$(1))" 2> /dev/null || { \
+        $(RM) $(RMFLAGS) -r "$(2)"; \
+        test -d "$(call _GeneratePackageExpansionPath,$(1))"; \
+}
+endef # _expand-and-patch-package-to-store
+
+# _expand-and-patch-package <key>
+#
+define _expand-and-patch-package
+$(if $(wildcard $(call _GeneratePackageExpansionPath,$(1))),,$(call _expand-and-patch-package-to-store,$(1),$(call _GeneratePackageExpansionPath,$(1)).$(subst /,-,$(ConditionalBuildTuple))))
+$(Echo) "Linking \"$(@)\" from expansion \"$(1)\""
+$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(dir $(@))"
+$(call link-tree,$(call Slashify,$(call _GeneratePackageExpansionPath,$(1)))$(notdir $(@)),$(@))
+$(Verbose)$(MKDIR) $(MKDIRFLAGS) "$(dir $(PackageExpansionLinksPath))"
+$(Verbose)$(GREP) $(GREPFLAGS) -q -x -F "$(abspath $(@))" "$(PackageExpansionLinksPath)" 2> /dev/null || echo "$(abspath $(@))" >> "$(PackageExpansionLinksPath)"
+$(Verbose)touch $(@)
+endef # _expand-and-patch-package
+
 # expand-and-patch-package
 #
 define expand-and-patch-package
-$(call expand-archive,$(call _GeneratePackagePaths,$(PackageArchive)),.)
-$(call patch-directory,$(@),$(PackagePatchArgs),$(PackagePatchPaths))
-$(Verbose)touch $(@)
+$(call _expand-and-patch-package,$(PackageExpansionKey))
 endef # expand-and-patch-package
@@ -87,7 +87,18 @@ BuildActions                    = $(AllBuildAction)       \
                                   $(DistCleanBuildAction) \
                                   $(PrepareBuildAction)   \
                                   $(PrettyBuildAction)    \
-                                  $(LintBuildAction)
+                                  $(LintBuildAction)      \
+                                  $(HeaderImpactBuildAction) \
+                                  $(IncludeAnalysisBuildAction) \
+                                  $(ProfileGuidedOptimizationBuildAction) \
+                                  $(LinkCompareBuildAction) \
+                                  $(SizeReportBuildAction) \
+                                  $(StartupBenchmarkBuildAction) \
+                                  $(CompileProfileBuildAction) \
+                                  $(ResourceReportBuildAction) \
+                                  $(BenchmarkBuildAction) \
+                                  $(TestBuildAction) \
+                                  $(CoverageBuildAction)
 
 #
 # All-related variables
@@ -203,6 +214,188 @@ LintBuildProducts               = $(call GenerateLintBuildTarget,$(BuildProducts
 LintBuildConfigs                = $(call GenerateLintBuildTarget,$(BuildConfigs))
 LintProductConfigs              = $(call GenerateLintBuildTarget,$(ProductConfigs))
 
+#
+# Header Impact-related variables
+#
+# Header impact targets are for reporting, from the dependency files
+# of a previously-built product configuration, which project headers
+# cause the most objects, and compile time, to be rebuilt when
+# changed.
+#
+
+HeaderImpactBuildAction         = header-impact
+
+GenerateHeaderImpactBuildTarget = $(call AddTargetPrefix,$(HeaderImpactBuildAction),$(1))
+
+HeaderImpactBuildProducts       = $(call GenerateHeaderImpactBuildTarget,$(BuildProducts))
+HeaderImpactBuildConfigs        = $(call GenerateHeaderImpactBuildTarget,$(BuildConfigs))
+HeaderImpactProductConfigs      = $(call GenerateHeaderImpactBuildTarget,$(ProductConfigs))
+
+#
+# Include Analysis-related variables
+#
+# Include analysis targets are for reporting, from the dependency
+# files of a previously-built product configuration, which include
+# directories of each target resolve no headers.
+#
+
+IncludeAnalysisBuildAction      = include-analysis
+
+GenerateIncludeAnalysisBuildTarget = $(call AddTargetPrefix,$(IncludeAnalysisBuildAction),$(1))
+
+IncludeAnalysisBuildProducts    = $(call GenerateIncludeAnalysisBuildTarget,$(BuildProducts))
+IncludeAnalysisBuildConfigs     = $(call GenerateIncludeAnalysisBuildTarget,$(BuildConfigs))
+IncludeAnalysisProductConfigs   = $(call GenerateIncludeAnalysisBuildTarget,$(ProductConfigs))
+
+#
+# Link Compare-related variables
+#
+# Link compare targets are for comparing, for a particular product,
+# configuration or combination thereof, the time to link its shared
+# libraries and programs with each available linker.
+#
+
+LinkCompareBuildAction          = link-compare
+
+GenerateLinkCompareBuildTarget  = $(call AddTargetPrefix,$(LinkCompareBuildAction),$(1))
+
+LinkCompareBuildProducts        = $(call GenerateLinkCompareBuildTarget,$(BuildProducts))
+LinkCompareBuildConfigs         = $(call GenerateLinkCompareBuildTarget,$(BuildConfigs))
+LinkCompareProductConfigs       = $(call GenerateLinkCompareBuildTarget,$(ProductConfigs))
+
+#
+# Size Report-related variables
+#
+# Size report targets are for reporting, for a particular product,
+# configuration or combination thereof, the section sizes of its
+# objects, archives, shared libraries and programs and how they have
+# changed since they were last reported.
+#
+
+SizeReportBuildAction           = size-report
+
+GenerateSizeReportBuildTarget   = $(call AddTargetPrefix,$(SizeReportBuildAction),$(1))
+
+SizeReportBuildProducts         = $(call GenerateSizeReportBuildTarget,$(BuildProducts))
+SizeReportBuildConfigs          = $(call GenerateSizeReportBuildTarget,$(BuildConfigs))
+SizeReportProductConfigs        = $(call GenerateSizeReportBuildTarget,$(ProductConfigs))
+
+#
+# Startup Benchmark-related variables
+#
+# Startup benchmark targets are for benchmarking, for a particular
+# product, configuration or combination thereof, the startup latency
+# of its programs and their link variants.
+#
+
+StartupBenchmarkBuildAction     = startup-benchmark
+
+GenerateStartupBenchmarkBuildTarget = $(call AddTargetPrefix,$(StartupBenchmarkBuildAction),$(1))
+
+StartupBenchmarkBuildProducts   = $(call GenerateStartupBenchmarkBuildTarget,$(BuildProducts))
+StartupBenchmarkBuildConfigs    = $(call GenerateStartupBenchmarkBuildTarget,$(BuildConfigs))
+StartupBenchmarkProductConfigs  = $(call GenerateStartupBenchmarkBuildTarget,$(ProductConfigs))
+
+#
+# Benchmark-related variables
+#
+# Benchmark targets are for running and comparing against their
+# baselines, for a particular product, configuration or combination
+# thereof, its benchmark programs.
+#
+
+BenchmarkBuildAction            = benchmark
+
+GenerateBenchmarkBuildTarget    = $(call AddTargetPrefix,$(BenchmarkBuildAction),$(1))
+
+BenchmarkBuildProducts          = $(call GenerateBenchmarkBuildTarget,$(BuildProducts))
+BenchmarkBuildConfigs           = $(call GenerateBenchmarkBuildTarget,$(BuildConfigs))
+BenchmarkProductConfigs         = $(call GenerateBenchmarkBuildTarget,$(ProductConfigs))
+
+#
+# Test-related variables
+#
+# Test targets are for running, in parallel, and reporting the
+# results of, for a particular product, configuration or combination
+# thereof, its tests, summarized across the tree.
+#
+
+TestBuildAction                 = test
+
+GenerateTestBuildTarget         = $(call AddTargetPrefix,$(TestBuildAction),$(1))
+
+TestBuildProducts               = $(call GenerateTestBuildTarget,$(BuildProducts))
+TestBuildConfigs                = $(call GenerateTestBuildTarget,$(BuildConfigs))
+TestProductConfigs              = $(call GenerateTestBuildTarget,$(ProductConfigs))
+
+#
+# Compile Profile-related variables
+#
+# Compile profile targets are for rebuilding a particular product,
+# configuration or combination thereof with compile-time tracing and
+# then reporting, from those traces, where its compile time is spent.
+#
+
+CompileProfileBuildAction       = compile-profile
+
+GenerateCompileProfileBuildTarget = $(call AddTargetPrefix,$(CompileProfileBuildAction),$(1))
+
+CompileProfileBuildProducts     = $(call GenerateCompileProfileBuildTarget,$(BuildProducts))
+CompileProfileBuildConfigs      = $(call GenerateCompileProfileBuildTarget,$(BuildConfigs))
+CompileProfileProductConfigs    = $(call GenerateCompileProfileBuildTarget,$(ProductConfigs))
+
+#
+# Resource Report-related variables
+#
+# Resource report targets are for rebuilding a particular product,
+# configuration or combination thereof with resource accounting and
+# then reporting, from the resulting ledger, the compiles and links
+# with the largest peak memory and CPU time.
+#
+
+ResourceReportBuildAction       = resource-report
+
+GenerateResourceReportBuildTarget = $(call AddTargetPrefix,$(ResourceReportBuildAction),$(1))
+
+ResourceReportBuildProducts     = $(call GenerateResourceReportBuildTarget,$(BuildProducts))
+ResourceReportBuildConfigs      = $(call GenerateResourceReportBuildTarget,$(BuildConfigs))
+ResourceReportProductConfigs    = $(call GenerateResourceReportBuildTarget,$(ProductConfigs))
+
+#
+# Coverage-related variables
+#
+# Coverage targets are for collecting, in parallel, the coverage data
+# of a particular product, configuration or combination thereof, made
+# with code coverage and since executed or tested, and then merging it
+# into a single coverage report.
+#
+
+CoverageBuildAction             = coverage
+
+GenerateCoverageBuildTarget     = $(call AddTargetPrefix,$(CoverageBuildAction),$(1))
+
+CoverageBuildProducts           = $(call GenerateCoverageBuildTarget,$(BuildProducts))
+CoverageBuildConfigs            = $(call GenerateCoverageBuildTarget,$(BuildConfigs))
+CoverageProductConfigs          = $(call GenerateCoverageBuildTarget,$(ProductConfigs))
+
+#
+# Profile-guided Optimization-related variables
+#
+# Profile-guided optimization targets are for building a particular
+# product, configuration or combination thereof instrumented, training
+# it by running its programs with their training arguments, merging
+# the resulting profile data, and then rebuilding it optimized with
+# that profile data.
+#
+
+ProfileGuidedOptimizationBuildAction = pgo
+
+GenerateProfileGuidedOptimizationBuildTarget = $(call AddTargetPrefix,$(ProfileGuidedOptimizationBuildAction),$(1))
+
+ProfileGuidedOptimizationBuildProducts = $(call GenerateProfileGuidedOptimizationBuildTarget,$(BuildProducts))
+ProfileGuidedOptimizationBuildConfigs = $(call GenerateProfileGuidedOptimizationBuildTarget,$(BuildConfigs))
+ProfileGuidedOptimizationProductConfigs = $(call GenerateProfileGuidedOptimizationBuildTarget,$(ProductConfigs))
+
 #
 # Other Support Functions
 #
@@ -221,13 +414,22 @@ SetMakeVars                     = $(join $(addsuffix =,$(1)),$(2))
 
 SplitTarget                     = $(subst $(TargetConcatenator), ,$(1))
 
+# JoinTarget
+#
+# This joins the specified white-space separated words into a build
+# target.
+
+JoinTarget                      = $(subst $(Space),$(TargetConcatenator),$(strip $(1)))
+
 # SplitAndFilterTarget
 #
 # This breaks the specified build target apart into white-space
-# separated words and filters out the specified word, if it exists,
-# from the list.
+# separated words and filters out the specified words, if they exist,
+# from the list. Since actions may themselves contain the target
+# concatenator (for example, 'header-impact'), the words to filter are
+# split in the same way.
 
-SplitAndFilterTarget            = $(filter-out $(1),$(call SplitTarget,$(2)))
+SplitAndFilterTarget            = $(filter-out $(call SplitTarget,$(1)),$(call SplitTarget,$(2)))
 
 # WordFromTarget <target>
 #
@@ -237,21 +439,23 @@ WordFromTarget                  = $(word $(2),$(call SplitTarget,$(1)))
 
 # ActionFromTarget <target>
 #
-# This extracts the build action from the specified concatenated target.
+# This extracts the build action from the specified concatenated
+# target. Since the action may itself contain the target concatenator,
+# it is everything preceding the product and configuration.
 
-ActionFromTarget                = $(call WordFromTarget,$(1),1)
+ActionFromTarget                = $(call JoinTarget,$(wordlist 1,$(words $(wordlist 3,$(words $(call SplitTarget,$(1))),$(call SplitTarget,$(1)))),$(call SplitTarget,$(1))))
 
 # ConfigurationFromTarget <target>
 #
 # This extracts the build configuration from the specified concatenated target.
 
-ConfigurationFromTarget         = $(call WordFromTarget,$(1),3)
+ConfigurationFromTarget         = $(lastword $(call SplitTarget,$(1)))
 
 # ProductFromTarget <target>
 #
 # This extracts the build product from the specified concatenated target.
 
-ProductFromTarget               = $(call WordFromTarget,$(1),2)
+ProductFromTarget               = $(call WordFromTarget,$(1),$(words $(wordlist 2,$(words $(call SplitTarget,$(1))),$(call SplitTarget,$(1)))))
 
 # SetBuildVarsFromList
 #
@@ -328,6 +532,113 @@ $(call prologue-banner,$(1))
 $(call postlogue-banner,$(1))
 endef
 
+# DispatchProfileGuidedOptimizationAction <target> <local action>
+#
+# Displays to standard output a prologue indicating the build action
+# requested and then, against the top-level project make file, builds
+# the product configuration instrumented, trains it, merges the
+# resulting profile data, and rebuilds it optimized with that data,
+# and then displays to standard output a completion postlogue.
+
+define DispatchProfileGuidedOptimizationAction
+$(call prologue-banner,$(1))
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) profile-clean
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) clean
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ProfileGuidedOptimizationPhase=generate $(PrepareBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ProfileGuidedOptimizationPhase=generate $(AllBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ProfileGuidedOptimizationPhase=generate train
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) profile-merge
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) clean
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ProfileGuidedOptimizationPhase=use $(PrepareBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ProfileGuidedOptimizationPhase=use $(AllBuildAction)
+$(call postlogue-banner,$(1))
+endef
+
+# DispatchCompileProfileAction <target> <local action>
+#
+# Displays to standard output a prologue indicating the build action
+# requested and then, against the top-level project make file,
+# rebuilds the product configuration from clean with compile-time
+# tracing, such that every object is traced, reports where its
+# compile time is spent, and then displays to standard output a
+# completion postlogue.
+
+define DispatchCompileProfileAction
+$(call prologue-banner,$(1))
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) clean
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) UseCompileTimeTrace=Yes $(PrepareBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) UseCompileTimeTrace=Yes $(AllBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) $(2)
+$(call postlogue-banner,$(1))
+endef
+
+# DispatchResourceReportAction <target> <local action>
+#
+# Displays to standard output a prologue indicating the build action
+# requested and then, against the top-level project make file,
+# rebuilds the product configuration from clean with resource
+# accounting, such that every compile and link is accounted for,
+# reports the heaviest of them, and then displays to standard output
+# a completion postlogue.
+
+define DispatchResourceReportAction
+$(call prologue-banner,$(1))
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) clean
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) resource-ledger-reset
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ResourceAccounting=Yes $(PrepareBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) ResourceAccounting=Yes $(AllBuildAction)
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) $(2)
+$(call postlogue-banner,$(1))
+endef
+
+# DispatchTestAction <target> <local action>
+#
+# Displays to standard output a prologue indicating the build action
+# requested and then, against the top-level project make file,
+# recursively runs the tests of the product configuration, keeping
+# going past any directory whose tests fail such that all are run,
+# summarizes their results across the tree, failing should any not
+# have passed, and then displays to standard output a completion
+# postlogue.
+
+define DispatchTestAction
+$(call prologue-banner,$(1))
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) --keep-going $(2); \
+status=$$?; \
+$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) $(2)-summary && exit $$status
+$(call postlogue-banner,$(1))
+endef
+
+# DispatchCoverageAction <target> <local action>
+#
+# Displays to standard output a prologue indicating the build action
+# requested and then, against the top-level project make file,
+# recursively collects the coverage data of the product configuration,
+# only that changed since last collected, merges it into a single
+# report, and then displays to standard output a completion
+# postlogue.
+
+define DispatchCoverageAction
+$(call prologue-banner,$(1))
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) $(2)-collect
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) $(2)-report
+$(call postlogue-banner,$(1))
+endef
+
+# DispatchBuildTraceAction <target> <local action> <project action>
+#
+# When build tracing is asserted, dispatches the requested build trace
+# action to the top-level project make file, otherwise does nothing.
+
+DispatchBuildTraceAction_       = $(Null)
+DispatchBuildTraceAction_N      = $(DispatchBuildTraceAction_)
+
+define DispatchBuildTraceAction_Y
++$(Verbose)$(MAKE) $(call GenerateMakeArgs,$(2),$(1)) $(3)
+endef
+
+DispatchBuildTraceAction        = $(call DispatchBuildTraceAction_$(call IsYes,$(BuildTrace)),$(1),$(2),$(3))
+
 # DispatchPrepareAction <target> <local action> <project action>
 #
 # For prepare only
@@ -393,8 +704,10 @@ $(AllBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
 
 .PHONY: $(AllProductConfigs)
 $(AllProductConfigs): $$(call GenerateCheckBuildTarget,$$(call RemoveTargetPrefix,$(AllBuildAction),$$(@)))
+	$(call DispatchBuildTraceAction,$(@),$(AllBuildAction),build-trace-reset)
 	$(call DispatchPrepareAction,$(@),$(AllBuildAction),$(PrepareBuildAction))
 	$(call DispatchBuildAction,$(@),$(AllBuildAction),$(AllBuildAction))
+	$(call DispatchBuildTraceAction,$(@),$(AllBuildAction),build-trace)
 
 # Generate specific configurations for all products.
 #
@@ -566,6 +879,296 @@ $(LintBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
 $(LintProductConfigs):
 	$(call DispatchBuildAction,$(@),$(LintBuildAction),$(LintBuildAction))
 
+#
+# Header Impact Action Targets
+#
+
+# Generate header impact action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(HeaderImpactBuildAction)
+$(HeaderImpactBuildAction): $(HeaderImpactProductConfigs)
+
+# Generate header impact action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(HeaderImpactBuildProducts)
+$(HeaderImpactBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate header impact action for all product configurations.
+
+.PHONY: $(HeaderImpactProductConfigs)
+$(HeaderImpactProductConfigs):
+	$(call DispatchBuildAction,$(@),$(HeaderImpactBuildAction),$(HeaderImpactBuildAction))
+
+#
+# Include Analysis Action Targets
+#
+
+# Generate include analysis action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(IncludeAnalysisBuildAction)
+$(IncludeAnalysisBuildAction): $(IncludeAnalysisProductConfigs)
+
+# Generate include analysis action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(IncludeAnalysisBuildProducts)
+$(IncludeAnalysisBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate include analysis action for all product configurations.
+
+.PHONY: $(IncludeAnalysisProductConfigs)
+$(IncludeAnalysisProductConfigs):
+	$(call DispatchBuildAction,$(@),$(IncludeAnalysisBuildAction),$(IncludeAnalysisBuildAction))
+
+#
+# Link Compare Action Targets
+#
+
+# Generate link compare action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(LinkCompareBuildAction)
+$(LinkCompareBuildAction): $(LinkCompareProductConfigs)
+
+# Generate link compare action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(LinkCompareBuildProducts)
+$(LinkCompareBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate link compare action for all product configurations.
+
+.PHONY: $(LinkCompareProductConfigs)
+$(LinkCompareProductConfigs):
+	$(call DispatchBuildAction,$(@),$(LinkCompareBuildAction),$(LinkCompareBuildAction))
+
+#
+# Size Report Action Targets
+#
+
+# Generate size report action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(SizeReportBuildAction)
+$(SizeReportBuildAction): $(SizeReportProductConfigs)
+
+# Generate size report action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(SizeReportBuildProducts)
+$(SizeReportBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate size report action for all product configurations.
+
+.PHONY: $(SizeReportProductConfigs)
+$(SizeReportProductConfigs):
+	$(call DispatchBuildAction,$(@),$(SizeReportBuildAction),$(SizeReportBuildAction))
+
+#
+# Startup Benchmark Action Targets
+#
+
+# Generate startup benchmark action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(StartupBenchmarkBuildAction)
+$(StartupBenchmarkBuildAction): $(StartupBenchmarkProductConfigs)
+
+# Generate startup benchmark action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(StartupBenchmarkBuildProducts)
+$(StartupBenchmarkBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate startup benchmark action for all product configurations.
+
+.PHONY: $(StartupBenchmarkProductConfigs)
+$(StartupBenchmarkProductConfigs):
+	$(call DispatchBuildAction,$(@),$(StartupBenchmarkBuildAction),$(StartupBenchmarkBuildAction))
+
+#
+# Benchmark Action Targets
+#
+
+# Generate benchmark action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(BenchmarkBuildAction)
+$(BenchmarkBuildAction): $(BenchmarkProductConfigs)
+
+# Generate benchmark action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(BenchmarkBuildProducts)
+$(BenchmarkBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate benchmark action for all product configurations.
+
+.PHONY: $(BenchmarkProductConfigs)
+$(BenchmarkProductConfigs):
+	$(call DispatchBuildAction,$(@),$(BenchmarkBuildAction),$(BenchmarkBuildAction))
+
+#
+# Test Action Targets
+#
+
+# Generate test action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(TestBuildAction)
+$(TestBuildAction): $(TestProductConfigs)
+
+# Generate test action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(TestBuildProducts)
+$(TestBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate test action for all product configurations.
+
+.PHONY: $(TestProductConfigs)
+$(TestProductConfigs):
+	$(call DispatchTestAction,$(@),$(TestBuildAction))
+
+#
+# Compile Profile Action Targets
+#
+
+# Generate compile profile action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(CompileProfileBuildAction)
+$(CompileProfileBuildAction): $(CompileProfileProductConfigs)
+
+# Generate compile profile action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(CompileProfileBuildProducts)
+$(CompileProfileBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate compile profile action for all product configurations,
+# checking the tools first.
+
+.PHONY: $(CompileProfileProductConfigs)
+$(CompileProfileProductConfigs): $$(call GenerateCheckBuildTarget,$$(call RemoveTargetPrefix,$(CompileProfileBuildAction),$$(@)))
+	$(call DispatchCompileProfileAction,$(@),$(CompileProfileBuildAction))
+
+#
+# Resource Report Action Targets
+#
+
+# Generate resource report action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(ResourceReportBuildAction)
+$(ResourceReportBuildAction): $(ResourceReportProductConfigs)
+
+# Generate resource report action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(ResourceReportBuildProducts)
+$(ResourceReportBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate resource report action for all product configurations,
+# checking the tools first.
+
+.PHONY: $(ResourceReportProductConfigs)
+$(ResourceReportProductConfigs): $$(call GenerateCheckBuildTarget,$$(call RemoveTargetPrefix,$(ResourceReportBuildAction),$$(@)))
+	$(call DispatchResourceReportAction,$(@),$(ResourceReportBuildAction))
+
+#
+# Coverage Action Targets
+#
+
+# Generate coverage action for all product configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(CoverageBuildAction)
+$(CoverageBuildAction): $(CoverageProductConfigs)
+
+# Generate coverage action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(CoverageBuildProducts)
+$(CoverageBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate coverage action for all product configurations.
+
+.PHONY: $(CoverageProductConfigs)
+$(CoverageProductConfigs):
+	$(call DispatchCoverageAction,$(@),$(CoverageBuildAction))
+
+#
+# Profile-guided Optimization Action Targets
+#
+
+# Generate profile-guided optimization action for all product
+# configutions.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(ProfileGuidedOptimizationBuildAction)
+$(ProfileGuidedOptimizationBuildAction): $(ProfileGuidedOptimizationProductConfigs)
+
+# Generate profile-guided optimization action for all products.
+#
+# Here, again, we leverage GNU make secondary expansion
+
+.SECONDEXPANSION:
+.PHONY: $(ProfileGuidedOptimizationBuildProducts)
+$(ProfileGuidedOptimizationBuildProducts): $(call AddTargetPrefix,$$@,$(BuildConfigs))
+
+# Generate profile-guided optimization action for all product
+# configurations, checking the tools first.
+
+.PHONY: $(ProfileGuidedOptimizationProductConfigs)
+$(ProfileGuidedOptimizationProductConfigs): $$(call GenerateCheckBuildTarget,$$(call RemoveTargetPrefix,$(ProfileGuidedOptimizationBuildAction),$$(@)))
+	$(call DispatchProfileGuidedOptimizationAction,$(@),$(ProfileGuidedOptimizationBuildAction))
+
 #
 # Help Target
 #
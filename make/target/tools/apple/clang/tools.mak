@@ -53,6 +53,8 @@ ClangNoAssembleFlag                = -S
 ClangNoLinkFlag                    = -c
 ClangInputFlag                     = 
 ClangPICFlag                       = $(call ToolAssertLanguageFlag,PIC)
+ClangHiddenVisibilityFlag          = $(call ToolAssertLanguageFlag,visibility=hidden)
+ClangHiddenInlinesVisibilityFlag   = $(call ToolAssertLanguageFlag,visibility-inlines-hidden)
 ClangCoverageFlag                  = --coverage
 
 # Debug variables
@@ -84,6 +86,9 @@ LangSanitize                       = sanitize
 LangStackProtection                = stack-protector-all
 LangOmitFramePointer               = omit-frame-pointer
 LangOptimizeSiblingCalls           = optimize-sibling-calls
+LangLinkTimeOptimization           = lto
+LangProfileGenerate                = profile-generate
+LangProfileUse                     = profile-use
 
 # Language sanitizers
 
@@ -147,6 +152,11 @@ ARCreateFlag                       = -c
 ARReplaceFlag                      = -r
 ARCreateStaticIndexFlag            = -s
 
+# The Darwin archiver has no thin archives, so archives are always
+# full, regardless of whether thin ones were requested.
+
+ArchiveThin_Y                      = $(Null)
+
 ARFLAGS                            = $(ARCreateFlag) $(ARReplaceFlag) $(ARCreateStaticIndexFlag)
 
 # The assembler
@@ -167,7 +177,10 @@ CPPUndefineFlag                    = -U
 CPPIncludeFlag                     = -I
 CPPInputFlag                       = $(ClangInputFlag)
 CPPOutputFlag                      = $(ClangOutputFlag)
-CPPDependFlags                     = -MT "$@ $(call GenerateDependPaths,$*.d)" -MD -MP -MF "$(call GenerateDependPaths,$*.d)"
+CPPDependFlag_UsePrunedDependencies_   := -MD
+CPPDependFlag_UsePrunedDependencies_N  := $(CPPDependFlag_UsePrunedDependencies_)
+CPPDependFlag_UsePrunedDependencies_Y  := -MMD
+CPPDependFlags                     = -MT "$@ $(call GenerateDependPaths,$*.d)" $(CPPDependFlag_UsePrunedDependencies_$(UsePrunedDependencies_Y)) -MP -MF "$(call GenerateDependPaths,$*.d)"
 
 CPPFLAGS                           = $(CPPOPTFLAGS) \
                                      $(call ToolGenerateDefineArgument,$(DEFINES)) \
@@ -184,6 +197,7 @@ CCNoLinkFlag                       = $(ClangNoLinkFlag)
 CCInputFlag                        = $(ClangInputFlag)
 CCOutputFlag                       = $(ClangOutputFlag)
 CCPICFlag                          = $(ClangPICFlag)
+CCHiddenVisibilityFlag             = $(ClangHiddenVisibilityFlag)
 CCCoverageFlag                     = $(ClangCoverageFlag)
 
 CCFLAGS                            = $(CCOPTIMIZER) $(CCOPTFLAGS) $(CCWARNINGS)
@@ -197,6 +211,7 @@ CXXNoLinkFlag                      = $(ClangNoLinkFlag)
 CXXInputFlag                       = $(ClangInputFlag)
 CXXOutputFlag                      = $(ClangOutputFlag)
 CXXPICFlag                         = $(ClangPICFlag)
+CXXHiddenVisibilityFlag            = $(ClangHiddenVisibilityFlag) $(ClangHiddenInlinesVisibilityFlag)
 CXXCoverageFlag                    = $(ClangCoverageFlag)
 
 CXXFLAGS                           = $(CXXOPTIMIZER) $(CXXOPTFLAGS) $(CXXWARNINGS)
@@ -244,6 +259,12 @@ LDOutputFlag                       = $(ClangOutputFlag)
 LDSharedFlag                       = -dynamiclib
 LDExportDynamicSymbols             = $(call ToolAssertLinkerFlag,-rdynamic)
 LDSharedNameFlag                   = $(call ToolAssertLinkerFlag,-install_name$(Comma))
+LDExportMapFlag                    = $(call ToolAssertLinkerFlag,-exported_symbols_list$(Comma))
+
+# With its two-level namespace, the Darwin dynamic linker already
+# binds references within a library to the library itself.
+
+LDSymbolicFunctionsFlag            = $(Null)
 LDResolvePathFlag                  = $(call ToolAssertLinkerFlag,-dylib_file$(Comma):)
 LDGCovFlag                         = --coverage -lprofile_rt
 
@@ -262,6 +283,21 @@ OBJCOPYName                        = $(call MakeToolName,$(OBJCOPY))
 RANLIB                            := $(ToolBinDir)/ranlib
 RANLIBName                         = $(call MakeToolName,$(OBJCOPY))
 
+# The profile data merger
+
+PROFDATA                          := $(ToolBinDir)/llvm-profdata
+PROFDATAName                       = $(call MakeToolName,$(PROFDATA))
+
+# The coverage data processor
+
+GCOV                              := $(ToolBinDir)/llvm-cov gcov
+GCOVName                           = $(call MakeToolName,$(firstword $(GCOV)))
+
+# The section sizer
+
+SECTIONSIZE                       := $(ToolBinDir)/size
+SECTIONSIZEName                    = $(call MakeToolName,$(SECTIONSIZE))
+
 # The symbol stripper
 
 STRIP                             := $(ToolBinDir)/strip
@@ -429,97 +465,97 @@ endef
 # Transform a C file into a raw assembler file. 
 
 define tool-preprocess-and-compile-c
-$(Verbose)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a C++ file into a raw assembler file. 
 
 define tool-preprocess-and-compile-c++
-$(Verbose)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform an Objective C file into a raw assembler file. 
 
 define tool-preprocess-and-compile-objective-c
-$(Verbose)$(OJBCC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(OJBCC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform an Objective C++ file into a raw assembler file. 
 
 define tool-preprocess-and-compile-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C file into a raw assembler file.
 
 define tool-compile-c
-$(Verbose)$(CC) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C++ file into a raw assembler file.
 
 define tool-compile-c++
-$(Verbose)$(CXX) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed Objective C file into a raw assembler file.
 
 define tool-compile-objective-c
-$(Verbose)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed Objective C++ file into a raw assembler file.
 
 define tool-compile-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a C file into an object file.
 
 define tool-preprocess-compile-and-assemble-c
-$(Verbose)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a C++ file into an object file.
 
 define tool-preprocess-compile-and-assemble-c++
-$(Verbose)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform an Objective C file into an object file.
 
 define tool-preprocess-compile-and-assemble-objective-c
-$(Verbose)$(CC) $(OBJCCLanguage) $(CPPFLAGS) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CPPFLAGS) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform an Objective C++ file into an object file.
 
 define tool-preprocess-compile-and-assemble-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C file into an object file.
 
 define tool-compile-and-assemble-c
-$(Verbose)$(CC) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C++ file into an object file.
 
 define tool-compile-and-assemble-c++
-$(Verbose)$(CXX) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C file into an object file.
 
 define tool-compile-and-assemble-objective-c
-$(Verbose)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C++ file into an object file.
 
 define tool-compile-and-assemble-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 define tool-depend-asm
@@ -551,27 +587,84 @@ endef
 
 # Transform a set of objects into an archive library file.
 
+# The archive is updated with only those of its member objects that
+# changed. The archive index is only separately created when the
+# archiver did not already create it.
+
 define tool-create-archive-library
-$(Verbose)$(AR) $(ARFLAGS) $(AROutputFlag) $@ $(ARInputFlag) $(filter-out $($(patsubst $(LibraryPrefix)%,%,$(notdir $(basename $@)))_GENERATION),$(?))
-$(Verbose)$(RANLIB) $(RANLIBFLAGS) $@
+$(Verbose)$(AR) $(ARFLAGS) $(AROutputFlag) $@ $(ARInputFlag) $(GenerationChangedMembers)
+$(if $(filter $(ARCreateStaticIndexFlag),$(ARFLAGS)),,$(Verbose)$(RANLIB) $(RANLIBFLAGS) $@)
+endef
+
+# Generate a linker exported symbols list, $@, from the shared
+# library export list, $<, which is either a version script, from
+# whose global symbols the list is made, or a list of symbol names,
+# one per line, with '#' comments. Symbol names are given their C
+# language underscore prefix.
+
+define tool-generate-export-map
+$(Verbose)if $(GREP) $(GREPFLAGS) -q '{' $<; then \
+	$(SED) $(SEDFLAGS) -n -e '/local:/,$$d' -e 's/^[[:space:]]*\([A-Za-z_][A-Za-z0-9_]*\);.*$$/_\1/p' $<; \
+else \
+	$(SED) $(SEDFLAGS) -n -e 's/^[[:space:]]*\([^#[:space:]][^[:space:]]*\).*$$/_\1/p' $<; \
+fi > $@
 endef
 
 # Transform a set of objects into a shared library file.
 
 define tool-link-shared-library
-$(Verbose)$(LD) $(LDFLAGS) $(LDSharedFlag) $(LDSharedNameFlag)$(@F) $(LDOutputFlag) $@ $(filter-out $(DEPLIBS) $($(patsubst $(LibraryPrefix)%,%,$(notdir $(basename $@)))_GENERATION),$^) $(call GenerateLibraryArguments,$(LDLIBS)) $(call GenerateResolveArguments,$(RESLIBS))
+$(Verbose)$(call ResourceAccount,Link)$(LD) $(LDFLAGS) $(LDSharedFlag) $(LDSharedNameFlag)$(@F) $(LDOutputFlag) $@ $(GenerationMembers) $(call GenerateLibraryArguments,$(LDLIBS)) $(call GenerateResolveArguments,$(RESLIBS))
 endef
 
 # Transform a set of objects and libraries into an executable program.
 
 define tool-link-program
-$(Verbose)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(filter-out $(DEPLIBS) $($(notdir $(basename $@))_GENERATION),$^) $(call GenerateLibraryArguments,$(LDLIBS)) $(call GenerateResolveArguments,$(RESLIBS))
+$(Verbose)$(call ResourceAccount,Link)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(GenerationMembers) $(call GenerateLibraryArguments,$(LDLIBS)) $(call GenerateResolveArguments,$(RESLIBS))
 endef
 
 # Transform a set of objects and libraries into an image
 
 define tool-link-image
-$(Verbose)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(filter-out $(DEPLIBS) $($(notdir $(basename $@))_GENERATION),$^) --start-group $(call GenerateLibraryArguments,$(LDLIBS)) --end-group --script=$(SCATTER) -Map=$(MAPFILE) $(call GenerateResolveArguments,$(RESLIBS))
+$(Verbose)$(call ResourceAccount,Link)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(filter-out $(DEPLIBS) $($(notdir $(basename $@))_GENERATION),$^) --start-group $(call GenerateLibraryArguments,$(LDLIBS)) --end-group --script=$(SCATTER) -Map=$(MAPFILE) $(call GenerateResolveArguments,$(RESLIBS))
+endef
+
+# Generate a fingerprint of the tool chain, comprised of the compiler
+# versions and a hash of the contents of the headers in the directory
+# trees they search by default, into the specified path. Contents,
+# rather than metadata, are hashed such that merely touching or
+# reinstalling identical headers does not change the fingerprint.
+
+define tool-generate-toolchain-fingerprint
+$(Verbose){ \
+	$(CC) --version; \
+	$(CXX) --version; \
+	for language in c c++; do \
+		$(CC) $(LANGFLAGS) -E -v -x $$language /dev/null -o /dev/null 2>&1 | \
+		$(SED) $(SEDFLAGS) -n -e '/^#include <\.\.\.>/,/^End of search list/s/^ \([^ ]*\).*$$/\1/p' | \
+		while read directory; do find -L "$$directory" -type f -print0 | LC_ALL=C sort -z | xargs -0 $(CKSUM); done | $(CKSUM); \
+	done; \
+} > "$(1)"
+endef
+
+# Generate a digest of the interface of the shared library, $<, that
+# is, the names and types of the symbols it exports and, for data,
+# since dependents may copy it, their sizes, into the specified path.
+# Function sizes change with their implementation rather than their
+# interface and are, consequently, omitted.
+#
+# Since Mach-O records no symbol sizes, that of a data symbol is taken
+# to be the distance, in address order, to the next symbol of the same
+# type, whether exported or not, if any.
+
+define tool-generate-interface-digest
+$(Verbose)$(NM) -n -U -P -t d $< | awk '{ if (name != "") print name " " type (((type ~ /^[BDS]$$/) && (toupper($$2) == type)) ? " " ($$3 - value) : ""); name = ($$2 ~ /^[A-Z]$$/) ? $$1 : ""; type = $$2; value = $$3 } END { if (name != "") print name " " type }' | sort -u > "$(1)"
+endef
+
+# Merge the raw profile data in the specified directory into that
+# used for profile-guided optimization.
+
+define tool-merge-profile
+$(Verbose)$(PROFDATA) merge -output="$(1)/$(ProfileDataName)" "$(1)"/*.profraw
 endef
 
 #
@@ -684,3 +777,137 @@ LDFLAGS_UseUndefinedSanitizer_Y    = $(call ToolAssertLanguageSanitizerFlag,$(La
 LANGFLAGS                         += $(LANGFLAGS_UseUndefinedSanitizer_$(UseUndefinedSanitizer_Y))
 
 LDFLAGS                           += $(LDFLAGS_UseUndefinedSanitizer_$(UseUndefinedSanitizer_Y))
+
+#
+# Dependency Pruning
+#
+# When asserted, dependencies are only generated against project,
+# rather than system and tool chain, headers. Changes to the latter
+# are, instead, tracked by the tool chain fingerprint against which
+# all objects depend.
+#
+
+UsePrunedDependencies_Y            = $(call IsYes,$(UsePrunedDependencies))
+
+#
+# Link-time Optimization
+#
+# When asserted, objects are compiled to intermediate representation
+# and optimized across translation units at link time using ThinLTO,
+# which runs its backend jobs in parallel within the linker. The
+# stock archiver and indexer already retain and index intermediate
+# representation archive members.
+#
+
+UseLinkTimeOptimization_Y            = $(call IsYes,$(UseLinkTimeOptimization))
+
+LANGFLAGS_UseLinkTimeOptimization_  := $(Null)
+LANGFLAGS_UseLinkTimeOptimization_N := $(LANGFLAGS_UseLinkTimeOptimization_)
+LANGFLAGS_UseLinkTimeOptimization_Y  = $(call ToolAssertLanguageFlag,$(LangLinkTimeOptimization)=thin)
+
+LDFLAGS_UseLinkTimeOptimization_    := $(Null)
+LDFLAGS_UseLinkTimeOptimization_N   := $(LDFLAGS_UseLinkTimeOptimization_)
+LDFLAGS_UseLinkTimeOptimization_Y    = $(call ToolAssertLanguageFlag,$(LangLinkTimeOptimization)=thin)
+
+LANGFLAGS                           += $(LANGFLAGS_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
+
+LDFLAGS                             += $(LDFLAGS_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
+
+#
+# Profile-guided Optimization
+#
+# When 'ProfileGuidedOptimizationPhase' is 'generate', objects and
+# programs are instrumented to write raw profile data, when run, to
+# the build tuple profile directory. When 'use', the profile data
+# merged from it optimizes them.
+#
+
+ProfileDataName                                    = default.profdata
+
+LANGFLAGS_ProfileGuidedOptimizationPhase_         := $(Null)
+LANGFLAGS_ProfileGuidedOptimizationPhase_generate  = $(call ToolAssertLanguageFlag,$(LangProfileGenerate)=$(ProfileDirectory))
+LANGFLAGS_ProfileGuidedOptimizationPhase_use       = $(call ToolAssertLanguageFlag,$(LangProfileUse)=$(call Slashify,$(ProfileDirectory))$(ProfileDataName))
+
+LDFLAGS_ProfileGuidedOptimizationPhase_           := $(Null)
+LDFLAGS_ProfileGuidedOptimizationPhase_generate    = $(LANGFLAGS_ProfileGuidedOptimizationPhase_generate)
+LDFLAGS_ProfileGuidedOptimizationPhase_use         = $(LANGFLAGS_ProfileGuidedOptimizationPhase_use)
+
+LANGFLAGS                                         += $(LANGFLAGS_ProfileGuidedOptimizationPhase_$(ProfileGuidedOptimizationPhase))
+
+LDFLAGS                                           += $(LDFLAGS_ProfileGuidedOptimizationPhase_$(ProfileGuidedOptimizationPhase))
+
+#
+# Split Debug Information
+#
+# Darwin already leaves debug information in objects, out of linked
+# targets, for dsymutil to collect, so there is nothing further to
+# split and debug information packages are never made.
+#
+
+UseSplitDebugInfo_Y                  = $(call IsYes,$(UseSplitDebugInfo))
+UseDebugInfoPackages_Y               = $(Null)
+
+#
+# Dead Code Stripping
+#
+# When asserted, each function and data item is placed in its own
+# section and the linker discards, by atom, those that are
+# unreferenced from shared libraries and programs.
+#
+
+UseDeadCodeStripping_Y                             = $(call IsYes,$(UseDeadCodeStripping))
+
+LANGFLAGS_UseDeadCodeStripping_                   := $(Null)
+LANGFLAGS_UseDeadCodeStripping_N                  := $(LANGFLAGS_UseDeadCodeStripping_)
+LANGFLAGS_UseDeadCodeStripping_Y                   = $(call ToolAssertLanguageFlag,$(LangFunctionSections)) $(call ToolAssertLanguageFlag,$(LangDataSections))
+
+LDFLAGS_UseDeadCodeStripping_                     := $(Null)
+LDFLAGS_UseDeadCodeStripping_N                    := $(LDFLAGS_UseDeadCodeStripping_)
+LDFLAGS_UseDeadCodeStripping_Y                     = $(call ToolAssertLinkerFlag,-dead_strip)
+
+LANGFLAGS                                         += $(LANGFLAGS_UseDeadCodeStripping_$(UseDeadCodeStripping_Y))
+
+LDFLAGS                                           += $(LDFLAGS_UseDeadCodeStripping_$(UseDeadCodeStripping_Y))
+
+#
+# Link Variants
+#
+# Darwin does not support static programs, so programs may only be
+# additionally linked as dynamic variants, with either immediate or
+# lazy binding, the latter being the default.
+#
+
+LinkVariants                                       = now lazy
+
+LDFLAGS_LinkVariant_                              := $(Null)
+LDFLAGS_LinkVariant_now                            = $(call ToolAssertLinkerFlag,-bind_at_load)
+LDFLAGS_LinkVariant_lazy                           = $(Null)
+
+#
+# Multi-versioning
+#
+# Mach-O has no indirect functions with which to dispatch, at load
+# time, among instruction set architecture level variants, so
+# multi-versioned sources are only compiled as usual.
+#
+
+MultiVersionLevels                                 = $(Null)
+
+#
+# Compile-time Tracing
+#
+# When asserted, each object compile writes a trace of where its time
+# was spent, down to the header parsed, template instantiated and
+# function optimized, into a file alongside the object, for the
+# 'compile-profile' target to aggregate.
+#
+
+UseCompileTimeTrace_Y                              = $(call IsYes,$(UseCompileTimeTrace))
+
+CompileTimeTraceSuffix                             = .time-trace
+
+CompileTimeTraceFlags_UseCompileTimeTrace_        := $(Null)
+CompileTimeTraceFlags_UseCompileTimeTrace_N       := $(CompileTimeTraceFlags_UseCompileTimeTrace_)
+CompileTimeTraceFlags_UseCompileTimeTrace_Y        = $(call ToolAssertLanguageFlag,time-trace=$@$(CompileTimeTraceSuffix))
+
+CompileTimeTraceFlags                              = $(CompileTimeTraceFlags_UseCompileTimeTrace_$(UseCompileTimeTrace_Y))
@@ -79,12 +79,19 @@ do-check-gcc: ToolDescription="GNU C compiler"
 do-check-g++: ToolPath=$(CXX)
 do-check-g++: ToolDescription="GNU C++ compiler"
 
+ifeq ($(UseLinker),)
 do-check-ld: ToolPath=$(LD)
 ifeq ($(UseLdAsLinker_Y),Y)
 do-check-ld: ToolSedArgs=$(BinutilsSedArgs)
 do-check-ld: ToolGrepArgs=$(BinutilsGrepArgs)
 endif # ifeq ($(UseLdAsLinker_Y),Y)
 do-check-ld: ToolDescription="GNU linker"
+else # ifeq ($(UseLinker),)
+do-check-ld: ToolPath=$(ToolBinDir)/$(CROSS_COMPILE)ld.$(UseLinker)
+do-check-ld: ToolSedArgs=$(LinkerSedArgs)
+do-check-ld: ToolGrepArgs=$(LinkerGrepArgs)
+do-check-ld: ToolDescription=$(LinkerDescription)
+endif # ifeq ($(UseLinker),)
 
 do-check-nm: ToolPath=$(NM)
 do-check-nm: ToolSedArgs=$(BinutilsSedArgs)
@@ -62,11 +62,16 @@ GccNoAssembleFlag               = -S
 GccNoLinkFlag                   = -c
 GccInputFlag                    = 
 GccPICFlag                      = $(call ToolAssertLanguageFlag,PIC)
+GccHiddenVisibilityFlag         = $(call ToolAssertLanguageFlag,visibility=hidden)
+GccHiddenInlinesVisibilityFlag  = $(call ToolAssertLanguageFlag,visibility-inlines-hidden)
 GccCoverageFlag                 = --coverage
 
 # Debug variables
 
 DebugFlag                       = -g
+DebugSplitFlag                  = -gsplit-dwarf
+DebugCompressFlag               = -gz
+DebugPackageFlag                = -gdwarf-4
 
 # Profile variables
 
@@ -93,6 +98,11 @@ LangSanitize                    = sanitize
 LangStackProtection             = stack-protector-all
 LangOmitFramePointer            = omit-frame-pointer
 LangOptimizeSiblingCalls        = optimize-sibling-calls
+LangLinkTimeOptimization        = lto
+LangProfileGenerate             = profile-generate
+LangProfileUse                  = profile-use
+LangProfileUpdate               = profile-update
+LangProfileCorrection           = profile-correction
 
 # Language sanitizers
 
@@ -145,18 +155,34 @@ WarnUnusedFunctions             = unused-function
 WarnWritableStrings             = write-strings
 WarnTypeLimits                  = type-limits
 WarnStackProtection             = stack-protector
+WarnMissingProfile              = missing-profile
 
 # The archiver (librarian)
 
-AR                              := $(ToolBinDir)/$(CROSS_COMPILE)ar
+AR_UseLinkTimeOptimization_    := $(ToolBinDir)/$(CROSS_COMPILE)ar
+AR_UseLinkTimeOptimization_N   := $(AR_UseLinkTimeOptimization_)
+AR_UseLinkTimeOptimization_Y   := $(ToolBinDir)/$(CROSS_COMPILE)gcc-ar
+
+AR                              = $(AR_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
 ARName                          = $(call MakeToolName,$(AR))
 ARInputFlag                     = 
 AROutputFlag                    = 
 ARCreateFlag                    = -c
 ARReplaceFlag                   = -r
 ARCreateStaticIndexFlag         = -s
+ARThinFlag                      = --thin
+
+# Thin archives only reference, rather than copy, their member
+# objects and, consequently, are only suitable for archives consumed
+# within the tree, where those objects remain in place.
+
+ArchiveThin_Y                   = $(call IsYes,$(ArchiveThin))
 
-ARFLAGS                         = $(ARCreateFlag) $(ARReplaceFlag) $(ARCreateStaticIndexFlag)
+ARFLAGS_ArchiveThin_           := $(Null)
+ARFLAGS_ArchiveThin_N          := $(ARFLAGS_ArchiveThin_)
+ARFLAGS_ArchiveThin_Y           = $(ARThinFlag)
+
+ARFLAGS                         = $(ARCreateFlag) $(ARReplaceFlag) $(ARCreateStaticIndexFlag) $(ARFLAGS_ArchiveThin_$(ArchiveThin_Y))
 
 # The assembler
 
@@ -176,7 +202,10 @@ CPPUndefineFlag                 = -U
 CPPIncludeFlag                  = -I
 CPPInputFlag                    = $(GccInputFlag)
 CPPOutputFlag                   = $(GccOutputFlag)
-CPPDependFlags                  = -MT "$@ $(call GenerateDependPaths,$*.d)" -MD -MP -MF "$(call GenerateDependPaths,$*.d)"
+CPPDependFlag_UsePrunedDependencies_   := -MD
+CPPDependFlag_UsePrunedDependencies_N  := $(CPPDependFlag_UsePrunedDependencies_)
+CPPDependFlag_UsePrunedDependencies_Y  := -MMD
+CPPDependFlags                  = -MT "$@ $(call GenerateDependPaths,$*.d)" $(CPPDependFlag_UsePrunedDependencies_$(UsePrunedDependencies_Y)) -MP -MF "$(call GenerateDependPaths,$*.d)"
 
 CPPFLAGS                        = $(CPPOPTFLAGS) \
                                   $(call ToolGenerateDefineArgument,$(DEFINES)) \
@@ -193,6 +222,7 @@ CCNoLinkFlag                    = $(GccNoLinkFlag)
 CCInputFlag                     = $(GccInputFlag)
 CCOutputFlag                    = $(GccOutputFlag)
 CCPICFlag                       = $(GccPICFlag)
+CCHiddenVisibilityFlag          = $(GccHiddenVisibilityFlag)
 CCCoverageFlag                  = $(GccCoverageFlag)
 
 CCFLAGS                         = $(CCOPTIMIZER) $(CCOPTFLAGS) $(CCWARNINGS)
@@ -206,9 +236,10 @@ CXXNoLinkFlag                   = $(GccNoLinkFlag)
 CXXInputFlag                    = $(GccInputFlag)
 CXXOutputFlag                   = $(GccOutputFlag)
 CXXPICFlag                      = $(GccPICFlag)
+CXXHiddenVisibilityFlag         = $(GccHiddenVisibilityFlag) $(GccHiddenInlinesVisibilityFlag)
 CXXCoverageFlag                 = $(GccCoverageFlag)
 
-CXXFLAGS                        = $(CXXOPTIMZER) $(CXXOPTFLAGS) $(CXXWARNINGS)
+CXXFLAGS                        = $(CXXOPTIMIZER) $(CXXOPTFLAGS) $(CXXWARNINGS)
 
 # The Objective C compiler flag
 
@@ -228,6 +259,11 @@ DEPENDOutputFlag                = -o
 DEPENDFLAGS                     = -E -MT "$(call GenerateBuildPaths,$*.o) $@" -MM -MP -MF $@
 
 # The linker
+#
+# Links are performed with the linker specified by 'UseLinker', if
+# any, or otherwise with the tool chain default.
+
+ToolLinker                      = $(UseLinker)
 
 LinkAgainstCPlusPlus_          := N
 LinkAgainstCPlusPlus_N          = $(call IsNo,$(LinkAgainstCPlusPlus))
@@ -239,7 +275,7 @@ LD_LinkAgainstCPlusPlus_Y       = $(ToolBinDir)/$(CROSS_COMPILE)g++
 
 LD_UseLdAsLinker_              := $(Null)
 LD_UseLdAsLinker_N             := $(LD_UseLdAsLinker_)
-LD_UseLdAsLinker_Y              = $(ToolBinDir)/$(CROSS_COMPILE)ld
+LD_UseLdAsLinker_Y              = $(ToolBinDir)/$(CROSS_COMPILE)ld$(addprefix .,$(ToolLinker))
 
 LD                              = $(if $(LD_UseLdAsLinker_$(UseLdAsLinker_Y)),$(LD_UseLdAsLinker_$(UseLdAsLinker_Y)),$(LD_LinkAgainstCPlusPlus_$(LinkAgainstCPlusPlus_Y)))
 
@@ -255,12 +291,28 @@ LDSharedFlag_UseLdAsLinker_Y   := $(call ToolAssertLinkerFlag,-shared)
 LDSharedFlag                    = $(LDSharedFlag_UseLdAsLinker_$(UseLdAsLinker_Y))
 LDExportDynamicSymbols          = $(call ToolAssertLinkerFlag,-rdynamic)
 LDSharedNameFlag                = $(call ToolAssertLinkerFlag,-soname=)
+LDExportMapFlag                 = $(call ToolAssertLinkerFlag,--version-script=)
+LDSymbolicFunctionsFlag         = $(call ToolAssertLinkerFlag,-Bsymbolic-functions)
 LDResolvePathFlag               = $(call ToolAssertLinkerFlag,-rpath-link)
 LDGCovFlag                      = --coverage -lgcov
 LDStartGroupFlag                = $(call ToolAssertLinkerFlag,--start-group)
 LDEndGroupFlag                  = $(call ToolAssertLinkerFlag,--end-group)
 LDScriptFlag                    = $(call ToolAssertLinkerFlag,--script=)
 LDMapFlag                       = $(call ToolAssertLinkerFlag,--Map=)
+LDFuseLinkerFlag                = $(if $(UseLdAsLinker_Y),,$(call ToolAssertLanguageFlag,use-ld=$(ToolLinker)))
+LDThreads                       = $(if $(BuildJobs),$(BuildJobs),$(BuildJobsDefault))
+LDGdbIndexFlag                  = $(if $(filter gold lld mold,$(ToolLinker)),$(call ToolAssertLinkerFlag,--gdb-index))
+
+# Link recipes are prefixed with this such that, when asserted, make
+# shares its jobserver with the linker (for example, for link-time
+# optimization partitions) rather than the linker running its own,
+# oversubscribed jobs.
+
+LDJobserverPrefix_UseLinkTimeOptimization_  := $(Null)
+LDJobserverPrefix_UseLinkTimeOptimization_N := $(LDJobserverPrefix_UseLinkTimeOptimization_)
+LDJobserverPrefix_UseLinkTimeOptimization_Y := +
+
+LDJobserverPrefix               = $(LDJobserverPrefix_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
 
 # The symbol lister
 
@@ -274,9 +326,33 @@ OBJCOPYName                     = $(call MakeToolName,$(OBJCOPY))
 
 # The library indexer
 
-RANLIB                          := $(ToolBinDir)/$(CROSS_COMPILE)ranlib
+RANLIB_UseLinkTimeOptimization_  := $(ToolBinDir)/$(CROSS_COMPILE)ranlib
+RANLIB_UseLinkTimeOptimization_N := $(RANLIB_UseLinkTimeOptimization_)
+RANLIB_UseLinkTimeOptimization_Y := $(ToolBinDir)/$(CROSS_COMPILE)gcc-ranlib
+
+RANLIB                          = $(RANLIB_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
 RANLIBName                      = $(call MakeToolName,$(OBJCOPY))
 
+# The object reader
+
+READELF                         := $(ToolBinDir)/$(CROSS_COMPILE)readelf
+READELFName                     = $(call MakeToolName,$(READELF))
+
+# The coverage data processor
+
+GCOV                            := $(ToolBinDir)/$(CROSS_COMPILE)gcov
+GCOVName                        = $(call MakeToolName,$(firstword $(GCOV)))
+
+# The debug information packager
+
+DWP                             := $(ToolBinDir)/$(CROSS_COMPILE)dwp
+DWPName                         = $(call MakeToolName,$(DWP))
+
+# The section sizer
+
+SECTIONSIZE                     := $(ToolBinDir)/$(CROSS_COMPILE)size
+SECTIONSIZEName                 = $(call MakeToolName,$(SECTIONSIZE))
+
 # The symbol stripper
 
 STRIP                           := $(ToolBinDir)/$(CROSS_COMPILE)strip
@@ -420,6 +496,30 @@ BinutilsGrepRegExp      = ^($(BinutilsVersRegExp) *$(BinutilsBuildRegExp))$$
 BinutilsGrepPattern     = "$(BinutilsGrepRegExp)"
 BinutilsGrepArgs        = $(BinutilsGrepPattern)
 
+#
+# Macros for checking alternate linker versions
+#
+# The GNU BFD and gold linkers use the binutils form of the version
+# string. The LLVM and mold linkers use the form "[<distribution>
+# ]LLD <version> (compatible with GNU linkers)" and "mold <version>
+# (<build>[; ]compatible with GNU ld)", respectively.
+#
+
+LinkerSedArgs_bfd       = $(BinutilsSedArgs)
+LinkerSedArgs_gold      = $(BinutilsSedArgs)
+LinkerSedArgs_lld       = "s/^(.*[[:space:]])?LLD[[:space:]]($(BinutilsSedVers)).*$$/\2/gp"
+LinkerSedArgs_mold      = "s/^mold[[:space:]]($(BinutilsSedVers)).*$$/\1/gp"
+
+LinkerSedArgs           = $(LinkerSedArgs_$(ToolLinker))
+LinkerGrepArgs          = $(BinutilsGrepArgs)
+
+LinkerDescription_bfd   = "GNU BFD linker"
+LinkerDescription_gold  = "GNU gold linker"
+LinkerDescription_lld   = "LLVM linker"
+LinkerDescription_mold  = "mold linker"
+
+LinkerDescription       = $(LinkerDescription_$(ToolLinker))
+
 #
 # Rule transformation definitions.
 #
@@ -464,97 +564,97 @@ endef
 # Transform a C file into a raw assembler file. 
 
 define tool-preprocess-and-compile-c
-$(Verbose)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a C++ file into a raw assembler file. 
 
 define tool-preprocess-and-compile-c++
-$(Verbose)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform an Objective C file into a raw assembler file. 
 
 define tool-preprocess-and-compile-objective-c
-$(Verbose)$(OJBCC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(OJBCC) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform an Objective C++ file into a raw assembler file. 
 
 define tool-preprocess-and-compile-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C file into a raw assembler file.
 
 define tool-compile-c
-$(Verbose)$(CC) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed C++ file into a raw assembler file.
 
 define tool-compile-c++
-$(Verbose)$(CXX) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed Objective C file into a raw assembler file.
 
 define tool-compile-objective-c
-$(Verbose)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a preprocessed Objective C++ file into a raw assembler file.
 
 define tool-compile-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CXXNoAssembleFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
 endef
 
 # Transform a C file into an object file.
 
 define tool-preprocess-compile-and-assemble-c
-$(Verbose)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CPPFLAGS) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform a C++ file into an object file.
 
 define tool-preprocess-compile-and-assemble-c++
-$(Verbose)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform an Objective C file into an object file.
 
 define tool-preprocess-compile-and-assemble-objective-c
-$(Verbose)$(CC) $(OBJCCLanguage) $(CPPFLAGS) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CPPFLAGS) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform an Objective C++ file into an object file.
 
 define tool-preprocess-compile-and-assemble-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CPPFLAGS) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform a preprocessed C file into an object file.
 
 define tool-compile-and-assemble-c
-$(Verbose)$(CC) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform a preprocessed C++ file into an object file.
 
 define tool-compile-and-assemble-c++
-$(Verbose)$(CXX) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform a preprocessed C file into an object file.
 
 define tool-compile-and-assemble-objective-c
-$(Verbose)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoLinkFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 # Transform a preprocessed C++ file into an object file.
 
 define tool-compile-and-assemble-objective-c++
-$(Verbose)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<))
+$(Verbose)$(call ResourceAccount,Compile)$(CXX) $(OBJCXXLanguage) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoLinkFlag) $(CXXOutputFlag) $@ $(CXXInputFlag) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
 endef
 
 define tool-depend-asm
@@ -584,30 +684,197 @@ define tool-process-depend
 $(Verbose)$(SED) $(SEDFLAGS) -r -e 's#(.{1,}/$*)\.([[:graph:]]{1,})[[:space:]]*:#\1.\2 $<:#g' < $(call CanonicalizePath,$(<)) > $@
 endef
 
+# The member objects of a thin archive library. Members are named
+# absolutely since, with the archive itself named absolutely, the
+# archiver records relative member names as given, relative to the
+# current directory, whereas they are resolved relative to the archive.
+
+ToolThinArchiveMembers = $(abspath $(GenerationMembers))
+
 # Transform a set of objects into an archive library file.
 
+# Since an existing archive cannot be converted to or from a thin
+# one and since rewriting the member references of a thin archive is
+# inexpensive, thin archives are always created anew rather than
+# updated, from only its member objects.
+#
+# Other archives are updated with only those of their member objects
+# that changed.
+#
+# The archive index is only separately created when the archiver
+# did not already create it.
+
 define tool-create-archive-library
-$(Verbose)$(AR) $(ARFLAGS) $(AROutputFlag) $@ $(ARInputFlag) $(filter-out $($(patsubst $(LibraryPrefix)%,%,$(notdir $(basename $@)))_GENERATION),$(?))
-$(Verbose)$(RANLIB) $(RANLIBFLAGS) $@
+$(if $(ArchiveThin_Y),$(Verbose)$(RM) $(RMFLAGS) $@)
+$(Verbose)$(AR) $(ARFLAGS) $(AROutputFlag) $@ $(ARInputFlag) $(if $(ArchiveThin_Y),$(ToolThinArchiveMembers),$(GenerationChangedMembers))
+$(if $(filter $(ARCreateStaticIndexFlag),$(ARFLAGS)),,$(Verbose)$(RANLIB) $(RANLIBFLAGS) $@)
+endef
+
+# Generate a linker version script, $@, from the shared library
+# export list, $<, which is either already a version script or a list
+# of symbol names, one per line, with '#' comments.
+
+define tool-generate-export-map
+$(Verbose)if $(GREP) $(GREPFLAGS) -q '{' $<; then \
+	cat $<; \
+else \
+	echo '{'; \
+	echo '  global:'; \
+	$(SED) $(SEDFLAGS) -n -e 's/^[[:space:]]*\([^#[:space:]][^[:space:]]*\).*$$/    \1;/p' $<; \
+	echo '  local:'; \
+	echo '    *;'; \
+	echo '};'; \
+fi > $@
 endef
 
 # Transform a set of objects into a shared library file.
 
 define tool-link-shared-library
-$(Verbose)$(LD) $(LDFLAGS) $(LDSharedFlag) $(LDSharedNameFlag)$(@F) $(LDOutputFlag) $@ $(filter-out $(DEPLIBS) $($(patsubst $(LibraryPrefix)%,%,$(notdir $(basename $@)))_GENERATION),$^) $(LDStartGroupFlag) $(call GenerateLibraryArguments,$(LDLIBS)) $(LDEndGroupFlag) $(call GenerateResolveArguments,$(RESLIBS))
+$(LDJobserverPrefix)$(Verbose)$(call ResourceAccount,Link)$(LD) $(LDFLAGS) $(LDSharedFlag) $(LDSharedNameFlag)$(@F) $(LDOutputFlag) $@ $(GenerationMembers) $(LDStartGroupFlag) $(call GenerateLibraryArguments,$(LDLIBS)) $(LDEndGroupFlag) $(call GenerateResolveArguments,$(RESLIBS))
 endef
 
 # Transform a set of objects and libraries into an executable program.
 
 define tool-link-program
-$(Verbose)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(filter-out $(DEPLIBS) $($(notdir $(basename $@))_GENERATION),$^) $(LDStartGroupFlag) $(call GenerateLibraryArguments,$(LDLIBS)) $(LDEndGroupFlag) $(call GenerateResolveArguments,$(RESLIBS))
+$(LDJobserverPrefix)$(Verbose)$(call ResourceAccount,Link)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(GenerationMembers) $(LDStartGroupFlag) $(call GenerateLibraryArguments,$(LDLIBS)) $(LDEndGroupFlag) $(call GenerateResolveArguments,$(RESLIBS))
 endef
 
 # Transform a set of objects and libraries into an image
 
 define tool-link-image
-$(Verbose)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(filter-out $(SCATTER) $(DEPLIBS) $($(notdir $(basename $@))_GENERATION),$^) $(LDStartGroupFlag) $(call GenerateLibraryArguments,$(LDLIBS)) $(LDEndGroupFlag) $(LDScriptFlag)$(SCATTER) $(LDMapFlag)$(MAPFILE) $(call GenerateResolveArguments,$(RESLIBS))
+$(LDJobserverPrefix)$(Verbose)$(call ResourceAccount,Link)$(LD) $(LDFLAGS) $(LDOutputFlag) $@ $(filter-out $(SCATTER) $(DEPLIBS) $($(notdir $(basename $@))_GENERATION),$^) $(LDStartGroupFlag) $(call GenerateLibraryArguments,$(LDLIBS)) $(LDEndGroupFlag) $(LDScriptFlag)$(SCATTER) $(LDMapFlag)$(MAPFILE) $(call GenerateResolveArguments,$(RESLIBS))
+endef
+
+# Generate a fingerprint of the tool chain, comprised of the compiler
+# versions and a hash of the contents of the headers in the directory
+# trees they search by default, into the specified path. Contents,
+# rather than metadata, are hashed such that merely touching or
+# reinstalling identical headers does not change the fingerprint.
+
+define tool-generate-toolchain-fingerprint
+$(Verbose){ \
+	$(CC) --version; \
+	$(CXX) --version; \
+	for language in c c++; do \
+		$(CC) $(LANGFLAGS) -E -v -x $$language /dev/null -o /dev/null 2>&1 | \
+		$(SED) $(SEDFLAGS) -n -e '/^#include <\.\.\.>/,/^End of search list/s/^ \([^ ]*\).*$$/\1/p' | \
+		while read directory; do find -L "$$directory" -type f -print0 | LC_ALL=C sort -z | xargs -0 $(CKSUM); done | $(CKSUM); \
+	done; \
+} > "$(1)"
+endef
+
+# Generate a digest of the interface of the shared library, $<, that
+# is, the names and types of the symbols it dynamically exports and,
+# for data, since dependents may copy it, their sizes, into the
+# specified path. Function sizes change with their implementation
+# rather than their interface and are, consequently, omitted.
+
+define tool-generate-interface-digest
+$(Verbose)$(NM) --dynamic --defined-only --portability $< | $(SED) $(SEDFLAGS) -n -e 's/^\([^ ]* [BDGRSVu]\) [^ ]*\( [^ ]*\)\{0,1\}$$/\1\2/p' -e 't' -e 's/^\([^ ]* [^ ]*\).*$$/\1/p' | sort -u > "$(1)"
 endef
+
+# List the names of the symbols of the specified type(s), as a 'sed'
+# bracket expression, for example, 'T' for external functions, '[TW]'
+# for those and weak functions or '[bd]' for static data, defined by
+# the specified object.
+
+ToolDefinedSymbols = $(NM) --defined-only --portability $(1) | $(SED) $(SEDFLAGS) -n -e 's/^\([^ ]*\) $(2) .*$$/\1/p'
+
+# The types of the external and of the static writable data symbols.
+
+ToolExternalDataSymbolTypes = BDGRS
+ToolStaticDataSymbolTypes = bdgs
+
+# List the signatures of the COMDAT section groups, through which the
+# linker folds duplicate inline functions, of the specified object.
+
+ToolSectionGroupSignatures = $(READELF) --section-groups $(1) | $(SED) $(SEDFLAGS) -n -e 's/^COMDAT group section .*\[\(.*\)\] contains .*$$/\1/p'
+
+# The sections through which an object initializes and finalizes its
+# data.
+
+ToolInitializerSections = .init_array* .fini_array* .ctors* .dtors*
+
+# Transform the multi-versioned C or C++ file, $<, per the specified
+# language, 'c' or 'c++', into the specified assembler file.
+
+define tool-compile-multiversion-level
+$(Verbose)$(call ResourceAccount,Compile)$(if $(filter c,$(1)),$(CC) $(CPPFLAGS) $(CCFLAGS) $(CompileTimeTraceFlags) $(CCNoAssembleFlag) $(CCOutputFlag) $(2) $(CCInputFlag),$(CXX) $(CPPFLAGS) $(CXXFLAGS) $(CompileTimeTraceFlags) $(CXXNoAssembleFlag) $(CXXOutputFlag) $(2) $(CXXInputFlag)) $(call CanonicalizePath,$(<)) $(CompileTimeTraceCapture)
+endef
+
+# Transform the specified multi-versioned assembler file into the
+# specified object file, with the data that the specified object, its
+# default variant, defines declared weak and, if static, hidden, such
+# that they are referenced by symbol and bound to those of the default
+# variant rather than to its own.
+#
+# When debug information is split, the compiler leaves it in the
+# assembler file, naming it after that file, so it is extracted from
+# the object file here, as the compiler would have when assembling.
+
+define tool-assemble-multiversion-level
+$(Verbose){ $(call ToolDefinedSymbols,$(3),[$(ToolExternalDataSymbolTypes)$(ToolStaticDataSymbolTypes)]) | $(SED) $(SEDFLAGS) -e 's/.*/.weak &/'; $(call ToolDefinedSymbols,$(3),[$(ToolStaticDataSymbolTypes)]) | $(SED) $(SEDFLAGS) -e 's/.*/.hidden &/'; } >> "$(1)"
+$(Verbose)$(AS) $(ASFLAGS) $(ASOutputFlag) $(2) $(ASInputFlag) $(1)
+$(if $(UseSplitDebugInfo_Y),$(Verbose)$(OBJCOPY) --extract-dwo $(2) $(basename $(1))$(SplitDebugSuffix))
+$(if $(UseSplitDebugInfo_Y),$(Verbose)$(OBJCOPY) --strip-dwo $(2))
+endef
+
+# Copy the specified object to the specified object, suffixing the
+# names of the external functions it defines with the specified
+# multi-versioning variant and the names of the static data it or, for
+# an instruction set architecture level variant, the specified default
+# variant object defines with the specified tag. The latter are made
+# external in the default variant, for the level variants to bind to.
+#
+# The weak functions and section groups of a level variant are
+# suffixed as well, such that inline functions compiled for one level
+# are neither bound nor folded in place of those of another, and its
+# initializers and finalizers are removed, such that the data of the
+# default variant are only initialized and finalized once, by it.
+#
+# Since the binutils 'objcopy' rejects an empty list of symbols to
+# make external, that is only specified when not empty.
+
+define tool-rename-multiversion-symbols
+$(Verbose)$(call ToolDefinedSymbols,$(if $(5),$(5),$(1)),[$(ToolStaticDataSymbolTypes)]) | sort -u > "$(2).statics"
+$(Verbose){ $(call ToolDefinedSymbols,$(1),$(if $(5),[TW],T)); $(if $(5),$(call ToolSectionGroupSignatures,$(1));) } | sort -u | $(SED) $(SEDFLAGS) -e 's/.*/& &.$(subst -,_,$(3))/' > "$(2).syms"
+$(Verbose)$(SED) $(SEDFLAGS) -e 's/.*/& &.$(4)/' "$(2).statics" >> "$(2).syms"
+$(Verbose)$(SED) $(SEDFLAGS) -e 's/.*/&.$(4)/' "$(2).statics" > "$(2).globals"
+$(Verbose)$(OBJCOPY) --redefine-syms="$(2).syms" $(if $(5),$(foreach section,$(ToolInitializerSections),--remove-section='$(section)'),`test -s "$(2).globals" && echo --globalize-symbols="$(2).globals"`) $(1) $(2)
+$(Verbose)$(RM) $(RMFLAGS) "$(2).statics" "$(2).syms" "$(2).globals"
+endef
+
+# Generate the run-time dispatcher source, $@, for the external
+# functions defined by the multi-versioned object, $<.
+
+define tool-generate-multiversion-dispatcher
+$(Verbose)$(call ToolDefinedSymbols,$<,T) | $(MKDISPATCHER) $(MKDISPATCHERFLAGS) -o $@ $(MultiVersionLevels)
+endef
+
+# List the absolute paths of the split debug information files
+# referenced by the specified linked target. The packager resolves
+# relative split debug information file names against its own
+# working directory rather than against the directory in which they
+# were compiled, which differs for archives and libraries built
+# elsewhere in the tree, so resolve them here instead.
+
+ToolSplitDebugInfoPaths = $(READELF) --debug-dump=info,no-follow-links $(1) | $(SED) $(SEDFLAGS) -n -e '/DW_AT_.*dwo_name/{s/.* //;h;}' -e '/DW_AT_comp_dir/{s/.* //;G;s|^[^\n]*\n/|/|;s|\n|/|;p;}' | sort -u
+
+# Package the split debug information for the program, $<, into a
+# debug information package file, $@.
+
+define tool-package-debug-info
+$(Verbose)$(DWP) -o $@ `$(call ToolSplitDebugInfoPaths,$<)`
+endef
+
+# Merge the raw profile data in the specified directory into that
+# used for profile-guided optimization. GCC accumulates profile data in
+# place across training runs, so there is nothing to merge.
+
+define tool-merge-profile
+$(Quiet)true
+endef
+
 #
 # Code Coverage
 #
@@ -705,3 +972,236 @@ LDFLAGS_UseUndefinedSanitizer_Y    = $(call ToolAssertLanguageSanitizerFlag,$(La
 LANGFLAGS                         += $(LANGFLAGS_UseUndefinedSanitizer_$(UseUndefinedSanitizer_Y))
 
 LDFLAGS                           += $(LDFLAGS_UseUndefinedSanitizer_$(UseUndefinedSanitizer_Y))
+
+#
+# Dependency Pruning
+#
+# When asserted, dependencies are only generated against project,
+# rather than system and tool chain, headers. Changes to the latter
+# are, instead, tracked by the tool chain fingerprint against which
+# all objects depend.
+#
+
+UsePrunedDependencies_Y            = $(call IsYes,$(UsePrunedDependencies))
+
+#
+# Link-time Optimization
+#
+# When asserted, objects are compiled to intermediate representation
+# and optimized across translation units at link time, with the
+# link-time optimization partitions run as jobs from the make
+# jobserver. Archives are created and indexed with the plugin-aware
+# archiver and indexer such that their members retain that
+# intermediate representation.
+#
+
+UseLinkTimeOptimization_Y            = $(call IsYes,$(UseLinkTimeOptimization))
+
+LANGFLAGS_UseLinkTimeOptimization_  := $(Null)
+LANGFLAGS_UseLinkTimeOptimization_N := $(LANGFLAGS_UseLinkTimeOptimization_)
+LANGFLAGS_UseLinkTimeOptimization_Y  = $(call ToolAssertLanguageFlag,$(LangLinkTimeOptimization))
+
+LDFLAGS_UseLinkTimeOptimization_    := $(Null)
+LDFLAGS_UseLinkTimeOptimization_N   := $(LDFLAGS_UseLinkTimeOptimization_)
+LDFLAGS_UseLinkTimeOptimization_Y    = $(call ToolAssertLanguageFlag,$(LangLinkTimeOptimization)=jobserver)
+
+LANGFLAGS                           += $(LANGFLAGS_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
+
+LDFLAGS                             += $(LDFLAGS_UseLinkTimeOptimization_$(UseLinkTimeOptimization_Y))
+
+#
+# Profile-guided Optimization
+#
+# When 'ProfileGuidedOptimizationPhase' is 'generate', objects and
+# programs are instrumented to write profile data, when run, to the
+# build tuple profile directory. When 'use', that profile data
+# optimizes them; objects not exercised in training are optimized as
+# usual.
+#
+
+LANGFLAGS_ProfileGuidedOptimizationPhase_         := $(Null)
+LANGFLAGS_ProfileGuidedOptimizationPhase_generate  = $(call ToolAssertLanguageFlag,$(LangProfileGenerate)=$(ProfileDirectory))
+LANGFLAGS_ProfileGuidedOptimizationPhase_generate += $(call ToolAssertLanguageFlag,$(LangProfileUpdate)=prefer-atomic)
+LANGFLAGS_ProfileGuidedOptimizationPhase_use       = $(call ToolAssertLanguageFlag,$(LangProfileUse)=$(ProfileDirectory))
+LANGFLAGS_ProfileGuidedOptimizationPhase_use      += $(call ToolAssertLanguageFlag,$(LangProfileCorrection))
+LANGFLAGS_ProfileGuidedOptimizationPhase_use      += $(call ToolDeassertWarningFlag,$(WarnMissingProfile))
+
+LDFLAGS_ProfileGuidedOptimizationPhase_           := $(Null)
+LDFLAGS_ProfileGuidedOptimizationPhase_generate    = $(LANGFLAGS_ProfileGuidedOptimizationPhase_generate)
+LDFLAGS_ProfileGuidedOptimizationPhase_use         = $(LANGFLAGS_ProfileGuidedOptimizationPhase_use)
+
+LANGFLAGS                                         += $(LANGFLAGS_ProfileGuidedOptimizationPhase_$(ProfileGuidedOptimizationPhase))
+
+LDFLAGS                                           += $(LDFLAGS_ProfileGuidedOptimizationPhase_$(ProfileGuidedOptimizationPhase))
+
+#
+# Program Profiling
+#
+# When 'ProfileInstrumentation', set only by the profile build
+# configuration from 'ProfileTool', is 'gprof', objects and programs
+# are instrumented to write call graph profile data when run. When
+# 'perf', no instrumentation is needed; call stacks are instead sampled
+# by frame pointer, which the profile build configuration preserves.
+#
+
+LANGFLAGS_ProfileInstrumentation_       := $(Null)
+LANGFLAGS_ProfileInstrumentation_perf   := $(LANGFLAGS_ProfileInstrumentation_)
+LANGFLAGS_ProfileInstrumentation_gprof   = $(ProfileFlag)
+
+LDFLAGS_ProfileInstrumentation_         := $(Null)
+LDFLAGS_ProfileInstrumentation_perf     := $(LDFLAGS_ProfileInstrumentation_)
+LDFLAGS_ProfileInstrumentation_gprof     = $(ProfileFlag)
+
+LANGFLAGS                               += $(LANGFLAGS_ProfileInstrumentation_$(ProfileInstrumentation))
+
+LDFLAGS                                 += $(LDFLAGS_ProfileInstrumentation_$(ProfileInstrumentation))
+
+#
+# Alternate Linkers
+#
+# When 'UseLinker' is 'bfd', 'gold', 'lld', or 'mold', links are
+# performed with that linker rather than the tool chain default and,
+# where the linker supports it, with as many threads as there are
+# build jobs.
+#
+
+LDFLAGS_UseLinker_      := $(Null)
+LDFLAGS_UseLinker_bfd    = $(LDFuseLinkerFlag)
+LDFLAGS_UseLinker_gold   = $(LDFuseLinkerFlag)
+LDFLAGS_UseLinker_gold  += $(call ToolAssertLinkerFlag,--threads)
+LDFLAGS_UseLinker_gold  += $(call ToolAssertLinkerFlag,--thread-count=$(LDThreads))
+LDFLAGS_UseLinker_lld    = $(LDFuseLinkerFlag)
+LDFLAGS_UseLinker_lld   += $(call ToolAssertLinkerFlag,--threads=$(LDThreads))
+LDFLAGS_UseLinker_mold   = $(LDFuseLinkerFlag)
+LDFLAGS_UseLinker_mold  += $(call ToolAssertLinkerFlag,--thread-count=$(LDThreads))
+
+LDFLAGS                 += $(LDFLAGS_UseLinker_$(ToolLinker))
+
+#
+# Split Debug Information
+#
+# When asserted, debug information is split out of objects into
+# compressed, per-object files alongside them in the build directory,
+# such that links need not copy it, and, with linkers that support
+# it, a debugger index is added to linked targets. When debug
+# information packages are also asserted, a package is made
+# alongside each program from the split debug information for it.
+#
+
+UseSplitDebugInfo_Y                  = $(call IsYes,$(UseSplitDebugInfo))
+UseDebugInfoPackages_Y               = $(if $(UseSplitDebugInfo_Y),$(call IsYes,$(UseDebugInfoPackages)))
+
+LANGFLAGS_UseSplitDebugInfo_        := $(Null)
+LANGFLAGS_UseSplitDebugInfo_N       := $(LANGFLAGS_UseSplitDebugInfo_)
+LANGFLAGS_UseSplitDebugInfo_Y        = $(DebugSplitFlag) $(DebugCompressFlag)
+
+LDFLAGS_UseSplitDebugInfo_          := $(Null)
+LDFLAGS_UseSplitDebugInfo_N         := $(LDFLAGS_UseSplitDebugInfo_)
+LDFLAGS_UseSplitDebugInfo_Y          = $(DebugCompressFlag) $(LDGdbIndexFlag)
+
+# The binutils debug information packager does not handle DWARF 5
+# split units, so fall back to DWARF 4 when packages are asserted.
+
+LANGFLAGS_UseDebugInfoPackages_     := $(Null)
+LANGFLAGS_UseDebugInfoPackages_N    := $(LANGFLAGS_UseDebugInfoPackages_)
+LANGFLAGS_UseDebugInfoPackages_Y     = $(DebugPackageFlag)
+
+LANGFLAGS                           += $(LANGFLAGS_UseSplitDebugInfo_$(UseSplitDebugInfo_Y))
+LANGFLAGS                           += $(LANGFLAGS_UseDebugInfoPackages_$(UseDebugInfoPackages_Y))
+
+LDFLAGS                             += $(LDFLAGS_UseSplitDebugInfo_$(UseSplitDebugInfo_Y))
+
+#
+# Dead Code Stripping
+#
+# When asserted, each function and data item is placed in its own
+# section such that the linker may discard those that are
+# unreferenced from shared libraries and programs.
+#
+
+UseDeadCodeStripping_Y               = $(call IsYes,$(UseDeadCodeStripping))
+
+LANGFLAGS_UseDeadCodeStripping_     := $(Null)
+LANGFLAGS_UseDeadCodeStripping_N    := $(LANGFLAGS_UseDeadCodeStripping_)
+LANGFLAGS_UseDeadCodeStripping_Y     = $(call ToolAssertLanguageFlag,$(LangFunctionSections)) $(call ToolAssertLanguageFlag,$(LangDataSections))
+
+LDFLAGS_UseDeadCodeStripping_       := $(Null)
+LDFLAGS_UseDeadCodeStripping_N      := $(LDFLAGS_UseDeadCodeStripping_)
+LDFLAGS_UseDeadCodeStripping_Y       = $(call ToolAssertLinkerFlag,--gc-sections)
+
+LANGFLAGS                           += $(LANGFLAGS_UseDeadCodeStripping_$(UseDeadCodeStripping_Y))
+
+LDFLAGS                             += $(LDFLAGS_UseDeadCodeStripping_$(UseDeadCodeStripping_Y))
+
+#
+# Link Variants
+#
+# Programs may be additionally linked, from the same objects, as one
+# or more of these variants: fully static; static and position-
+# independent, which requires position-independent objects; or
+# dynamic, with either immediate or lazy binding, the latter with
+# only the GNU symbol hash table.
+#
+
+LinkVariants                         = static static-pie now lazy
+
+LDFLAGS_LinkVariant_                := $(Null)
+LDFLAGS_LinkVariant_static           = -static
+LDFLAGS_LinkVariant_static-pie       = -static-pie
+LDFLAGS_LinkVariant_now              = $(call ToolAssertLinkerFlag,-z$(Comma)now)
+LDFLAGS_LinkVariant_lazy             = $(call ToolAssertLinkerFlag,-z$(Comma)lazy) $(call ToolAssertLinkerFlag,--hash-style=gnu)
+
+#
+# Multi-versioning
+#
+# The sources a target lists in 'MULTIVERSION_SOURCES' are, in
+# addition to their default objects, compiled once for each of these
+# instruction set architecture levels of the target architecture,
+# with the external functions of each variant suffixed by level and
+# dispatched, at load time, via an indirect function, to the variant
+# for the highest level the processor supports. Since their symbols
+# are renamed after compilation, these objects are never link-time
+# optimized.
+#
+# Since the compiler can only both compile for and dispatch among
+# these levels from GCC 12, they are otherwise empty. The compiler
+# version is checked lazily, just once, and only when needed.
+#
+
+ToolMultiVersionMajorVersionMacro    = __GNUC__
+ToolMultiVersionMinimumMajorVersion  = 12
+
+ToolMultiVersionSupported            = $(eval ToolMultiVersionSupported := $(shell test "`$(CC) -dM -E -x c /dev/null 2> /dev/null | $(SED) $(SEDFLAGS) -n -e 's/^\#define $(ToolMultiVersionMajorVersionMacro) //p'`" -ge $(ToolMultiVersionMinimumMajorVersion) 2> /dev/null && echo Y))$(ToolMultiVersionSupported)
+
+MultiVersionLevels_x86_64            = $(if $(ToolMultiVersionSupported),x86-64-v2 x86-64-v3 x86-64-v4)
+
+MultiVersionLevels                   = $(MultiVersionLevels_$(firstword $(subst -, ,$(TargetTuple))))
+
+MultiVersionFlags                    = $(call ToolDeassertLanguageFlag,$(LangLinkTimeOptimization))
+
+ToolMultiVersionLevelFlag            = $(call ToolAssertMachineFlag,arch=$(1))
+
+#
+# Compile-time Tracing
+#
+# When asserted, each object compile reports the time it spent in
+# each compiler phase into a file alongside the object, for the
+# 'compile-profile' target to aggregate. Since GCC only reports this
+# time to standard error, after any diagnostics, standard error is
+# captured into that file and those diagnostics are then re-emitted.
+#
+
+UseCompileTimeTrace_Y                = $(call IsYes,$(UseCompileTimeTrace))
+
+CompileTimeTraceSuffix               = .time-report
+
+CompileTimeTraceFlags_UseCompileTimeTrace_    := $(Null)
+CompileTimeTraceFlags_UseCompileTimeTrace_N   := $(CompileTimeTraceFlags_UseCompileTimeTrace_)
+CompileTimeTraceFlags_UseCompileTimeTrace_Y    = $(call ToolAssertLanguageFlag,time-report)
+
+CompileTimeTraceCapture_UseCompileTimeTrace_  := $(Null)
+CompileTimeTraceCapture_UseCompileTimeTrace_N := $(CompileTimeTraceCapture_UseCompileTimeTrace_)
+CompileTimeTraceCapture_UseCompileTimeTrace_Y  = 2> "$@$(CompileTimeTraceSuffix)"; status=$$?; $(SED) $(SEDFLAGS) -n -e '/^$$/{N;/\nTime variable/q;}' -e p "$@$(CompileTimeTraceSuffix)" >&2; exit $$status
+
+CompileTimeTraceFlags                = $(CompileTimeTraceFlags_UseCompileTimeTrace_$(UseCompileTimeTrace_Y))
+CompileTimeTraceCapture              = $(CompileTimeTraceCapture_UseCompileTimeTrace_$(UseCompileTimeTrace_Y))
@@ -0,0 +1,114 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines rules and targets common to all LLVM clang
+#      versions targeting Linux and other ELF-based systems.
+#
+
+.PHONY: maybe-check-binutils
+maybe-check-binutils: maybe-check-archivers \
+	maybe-check-objcopiers \
+	maybe-check-linkers \
+	maybe-check-strippers
+
+.PHONY: maybe-check-assemblers
+maybe-check-assemblers: do-check-as
+
+.PHONY: maybe-check-preprocessors
+maybe-check-preprocessors: do-check-cpp
+
+.PHONY: maybe-check-archivers
+maybe-check-archivers: do-check-ar do-check-ranlib
+
+.PHONY: maybe-check-compilers
+maybe-check-compilers: do-check-gcc \
+	do-check-g++ \
+
+.PHONY: maybe-check-linkers
+maybe-check-linkers: do-check-ld
+
+.PHONY: maybe-check-objcopiers
+maybe-check-objcopiers: do-check-objcopy
+
+.PHONY: maybe-check-strippers
+maybe-check-strippers: do-check-strip
+
+.PHONY: do-check-ar \
+	do-check-as \
+	do-check-cpp \
+	do-check-gcc \
+	do-check-g++ \
+	do-check-ld \
+	do-check-objcopy \
+	do-check-ranlib \
+	do-check-strip
+
+ToolSedArgs=$(ClangSedArgs)
+ToolGrepArgs=$(ClangGrepArgs)
+ToolVersionArgs="--version"
+
+do-check-ar: ToolPath=$(AR)
+do-check-ar: ToolSedArgs=$(LLVMSedArgs)
+do-check-ar: ToolGrepArgs=$(LLVMGrepArgs)
+do-check-ar: ToolDescription="LLVM archiver"
+
+do-check-as: ToolPath=$(AS)
+do-check-as: ToolDescription="LLVM clang assembler"
+
+# The preprocessor is the compiler driver with an option, which the
+# version option supersedes.
+
+do-check-cpp: ToolPath=$(CPP)
+do-check-cpp: ToolDescription="LLVM clang preprocessor"
+
+do-check-gcc: ToolPath=$(CC)
+do-check-gcc: ToolDescription="LLVM clang C compiler"
+
+do-check-g++: ToolPath=$(CXX)
+do-check-g++: ToolDescription="LLVM clang C++ compiler"
+
+# Unless the linker is run directly, links are performed through the
+# compiler driver, so check the linker it is asked to use.
+
+do-check-ld: ToolPath=$(ToolBinDir)/ld.$(ToolLinker)
+do-check-ld: ToolSedArgs=$(LinkerSedArgs)
+do-check-ld: ToolGrepArgs=$(LinkerGrepArgs)
+do-check-ld: ToolDescription=$(LinkerDescription)
+
+do-check-nm: ToolPath=$(NM)
+do-check-nm: ToolSedArgs=$(LLVMSedArgs)
+do-check-nm: ToolGrepArgs=$(LLVMGrepArgs)
+do-check-nm: ToolDescription="LLVM symbol lister"
+
+do-check-objcopy: ToolPath=$(OBJCOPY)
+do-check-objcopy: ToolSedArgs=$(LLVMSedArgs)
+do-check-objcopy: ToolGrepArgs=$(LLVMGrepArgs)
+do-check-objcopy: ToolDescription="LLVM file translator"
+
+do-check-ranlib: ToolPath=$(RANLIB)
+do-check-ranlib: ToolSedArgs=$(LLVMSedArgs)
+do-check-ranlib: ToolGrepArgs=$(LLVMGrepArgs)
+do-check-ranlib: ToolDescription="LLVM library indexer"
+
+do-check-strip: ToolPath=$(STRIP)
+do-check-strip: ToolSedArgs=$(LLVMSedArgs)
+do-check-strip: ToolGrepArgs=$(LLVMGrepArgs)
+do-check-strip: ToolDescription="LLVM symbol stripper"
+
+do-check-ar do-check-as do-check-cpp do-check-gcc do-check-g++ do-check-ld do-check-nm do-check-objcopy do-check-ranlib do-check-strip:
+	$(check-tool-version)
@@ -0,0 +1,266 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines access paths, environment variables and basic
+#      flags for tools common to all LLVM clang versions targeting
+#      Linux and other ELF-based systems.
+#
+
+#
+# The clang compiler driver accepts the options of, and the LLVM
+# binary utilities stand in for, their GNU counterparts on ELF-based
+# systems, so just source the GNU GCC common tools.
+#
+
+include target/tools/gnu/gcc/tools.mak
+
+#
+# However, override the GNU GCC tools and those of their options,
+# rules and features where clang and the LLVM tools differ.
+#
+
+# Unless otherwise specified with 'UseLinker', links are performed
+# with the LLVM linker rather than the system default.
+
+ClangLinkerDefault              = lld
+ToolLinker                      = $(if $(UseLinker),$(UseLinker),$(ClangLinkerDefault))
+
+# Unlike that of binutils, the LLVM debug information packager
+# handles DWARF 5 split units, so there is no need to fall back to
+# DWARF 4 when packages are asserted.
+
+DebugPackageFlag                = $(Null)
+
+WarnMissingProfile              = profile-instr-missing
+
+# The archiver (librarian) and library indexer
+#
+# The LLVM archiver and indexer natively read and index intermediate
+# representation members, so no plugin-aware variants are needed for
+# link-time optimization.
+
+AR                             := $(ToolBinDir)/llvm-ar
+RANLIB                         := $(ToolBinDir)/llvm-ranlib
+
+# The assembler
+
+AS                             := $(ToolBinDir)/clang
+
+# The C preprocessor
+#
+# There is no stand-alone clang preprocessor; the driver only
+# preprocesses when asked.
+
+CPP                            := $(CCACHE) $(ToolBinDir)/clang -E
+
+# The C and C++ compilers
+
+CC                             := $(CCACHE) $(ToolBinDir)/clang
+CXX                            := $(CCACHE) $(ToolBinDir)/clang++
+
+# The dependency generator
+
+DEPEND                         := $(ToolBinDir)/clang
+
+# The linker
+
+LD_LinkAgainstCPlusPlus_       := $(ToolBinDir)/clang
+LD_LinkAgainstCPlusPlus_N      := $(LD_LinkAgainstCPlusPlus_)
+LD_LinkAgainstCPlusPlus_Y       = $(ToolBinDir)/clang++
+
+LD_UseLdAsLinker_Y              = $(ToolBinDir)/ld.$(ToolLinker)
+
+LDGCovFlag                      = --coverage
+
+# Unlike that of GCC, the ThinLTO backend runs its jobs within the
+# linker itself, bounded by the linker thread count, rather than
+# through the make jobserver, so link recipes need no prefix.
+
+LDJobserverPrefix               = $(Null)
+
+# The remaining binary utilities
+
+NM                             := $(ToolBinDir)/llvm-nm
+OBJCOPY                        := $(ToolBinDir)/llvm-objcopy
+READELF                        := $(ToolBinDir)/llvm-readelf
+GCOV                           := $(ToolBinDir)/llvm-cov gcov
+DWP                            := $(ToolBinDir)/llvm-dwp
+SECTIONSIZE                    := $(ToolBinDir)/llvm-size
+STRIP                          := $(ToolBinDir)/llvm-strip
+
+# The profile data merger
+
+PROFDATA                       := $(ToolBinDir)/llvm-profdata
+PROFDATAName                    = $(call MakeToolName,$(PROFDATA))
+
+#
+# Unlike GCC, the LLVM compilers and binary utilities are released
+# together and share a version. However, the latter report that
+# version differently and the linker may still come from binutils, so
+# each is checked as such.
+#
+
+#
+# Macros for checking clang tool versions
+#
+
+# The version of the clang-based tool, which must be precisely a
+# two- or three-digit tuple where each tuple is one or more digits,
+# separated by a period (.).
+
+ClangSedVers            = ([[:digit:]]{1,}\.*){2,3}
+
+# The form of the version string for clang-based tools is
+# "[<distribution><space>]clang version <version>[<build cruft>][<space>
+# (<build>)]".
+
+ClangSedRegExp          = ^(.*[[:space:]])?clang[[:space:]]version[[:space:]]($(ClangSedVers))[^[:space:]]*([[:space:]]+\((.*)\))?[[:space:]]*$$
+
+# The sed 's' command that will match, extract, and process the
+# version and, as the build, the distribution and any build that
+# follows the version.
+
+ClangSedCommand         = "s/$(ClangSedRegExp)/\2 (\1\5)/gp"
+ClangSedArgs            = $(ClangSedCommand)
+
+# The grep regular expression, pattern, and arguments used to match
+# the expected version.
+
+ClangGrepRegExp         = ^($(ClangVersRegExp)[[:space:]]\($(ClangBuildRegExp)\))$$
+ClangGrepPattern        = "$(ClangGrepRegExp)"
+ClangGrepArgs           = $(ClangGrepPattern)
+
+#
+# Macros for checking LLVM binary utility versions
+#
+# The LLVM binary utilities use the form "[<distribution> ]LLVM
+# version <version>" on a line of its own.
+#
+
+LLVMSedVers             = ([[:digit:]]{1,}\.*){2,3}
+
+LLVMSedRegExp           = ^(.*[[:space:]])?LLVM[[:space:]]version[[:space:]]($(LLVMSedVers)).*$$
+
+LLVMSedCommand          = "s/$(LLVMSedRegExp)/\2/gp"
+LLVMSedArgs             = $(LLVMSedCommand)
+
+LLVMGrepRegExp          = ^($(LLVMVersRegExp))$$
+LLVMGrepPattern         = "$(LLVMGrepRegExp)"
+LLVMGrepArgs            = $(LLVMGrepPattern)
+
+#
+# Macros for checking linker versions
+#
+# The LLVM linker shares its version with the other LLVM tools.
+#
+
+LinkerSedArgs_lld       = "s/^(.*[[:space:]])?LLD[[:space:]]($(LLVMSedVers)).*$$/\2/gp"
+
+LinkerGrepArgs_bfd      = $(BinutilsGrepArgs)
+LinkerGrepArgs_gold     = $(BinutilsGrepArgs)
+LinkerGrepArgs_lld      = $(LLVMGrepArgs)
+LinkerGrepArgs_mold     = $(BinutilsGrepArgs)
+
+LinkerGrepArgs          = $(LinkerGrepArgs_$(ToolLinker))
+
+#
+# Rule transformation definitions.
+#
+
+# Transform an Objective C file into a raw assembler file.
+
+define tool-preprocess-and-compile-objective-c
+$(Verbose)$(call ResourceAccount,Compile)$(CC) $(OBJCCLanguage) $(CPPFLAGS) $(CCFLAGS) $(CCNoAssembleFlag) $(CCOutputFlag) $@ $(CCInputFlag) $(call CanonicalizePath,$(<))
+endef
+
+# The member objects of a thin archive library. Members are named as
+# usual, relative to the current directory, which the archiver
+# records relative to the archive instead, such that the archive and
+# its members may be relocated together.
+
+ToolThinArchiveMembers = $(GenerationMembers)
+
+# Package the split debug information for the program, $<, into a
+# debug information package file, $@. Unlike that of binutils, the
+# LLVM packager finds the split debug information files referenced by
+# the program itself, resolving them against the directory in which
+# they were compiled.
+
+define tool-package-debug-info
+$(Verbose)$(DWP) -e $< -o $@
+endef
+
+# Merge the raw profile data in the specified directory into that
+# used for profile-guided optimization.
+
+define tool-merge-profile
+$(Verbose)$(PROFDATA) merge -output="$(1)/$(ProfileDataName)" "$(1)"/*.profraw
+endef
+
+#
+# Link-time Optimization
+#
+# Objects are optimized across translation units at link time using
+# ThinLTO, which runs its backend jobs in parallel within the linker,
+# with as many jobs as there are build jobs, caching their results in
+# the build directory across links.
+#
+
+LANGFLAGS_UseLinkTimeOptimization_Y  = $(call ToolAssertLanguageFlag,$(LangLinkTimeOptimization)=thin)
+
+LDFLAGS_UseLinkTimeOptimization_Y    = $(call ToolAssertLanguageFlag,$(LangLinkTimeOptimization)=thin)
+LDFLAGS_UseLinkTimeOptimization_Y   += $(if $(filter lld,$(ToolLinker)),$(call ToolAssertLinkerFlag,--thinlto-jobs=$(LDThreads)))
+LDFLAGS_UseLinkTimeOptimization_Y   += $(if $(filter lld,$(ToolLinker)),$(call ToolAssertLinkerFlag,--thinlto-cache-dir=$(BuildDirectory)/.thinlto-cache))
+
+#
+# Profile-guided Optimization
+#
+# Programs instrumented by 'generate' write raw profile data, which is
+# merged and then, by 'use', optimizes them.
+#
+
+ProfileDataName                                    = default.profdata
+
+LANGFLAGS_ProfileGuidedOptimizationPhase_generate  = $(call ToolAssertLanguageFlag,$(LangProfileGenerate)=$(ProfileDirectory))
+LANGFLAGS_ProfileGuidedOptimizationPhase_generate += $(call ToolAssertLanguageFlag,$(LangProfileUpdate)=atomic)
+LANGFLAGS_ProfileGuidedOptimizationPhase_use       = $(call ToolAssertLanguageFlag,$(LangProfileUse)=$(call Slashify,$(ProfileDirectory))$(ProfileDataName))
+LANGFLAGS_ProfileGuidedOptimizationPhase_use      += $(call ToolDeassertWarningFlag,$(WarnMissingProfile))
+
+#
+# Instruction Set Architecture Multi-versioning
+#
+# The compiler can only both compile for and dispatch among the
+# levels from clang 19.
+#
+
+ToolMultiVersionMajorVersionMacro    = __clang_major__
+ToolMultiVersionMinimumMajorVersion  = 19
+
+#
+# Compile-time Tracing
+#
+# The compiler writes a trace of where its time was spent, down to the
+# header parsed, template instantiated and function optimized, into the
+# file itself, so there is nothing to capture.
+#
+
+CompileTimeTraceSuffix               = .time-trace
+
+CompileTimeTraceFlags_UseCompileTimeTrace_Y  = $(call ToolAssertLanguageFlag,time-trace=$@$(CompileTimeTraceSuffix))
+
+CompileTimeTraceCapture              = $(Null)
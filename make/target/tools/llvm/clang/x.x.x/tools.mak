@@ -0,0 +1,52 @@
+#
+#    Copyright (c) 2024 Nuovation System Design, LLC. All Rights Reserved.
+#
+#    Licensed under the Apache License, Version 2.0 (the "License");
+#    you may not use this file except in compliance with the License.
+#    You may obtain a copy of the License at
+#
+#        http://www.apache.org/licenses/LICENSE-2.0
+#
+#    Unless required by applicable law or agreed to in writing, software
+#    distributed under the License is distributed on an "AS IS" BASIS,
+#    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#    See the License for the specific language governing permissions and
+#    limitations under the License.
+#
+
+##
+#    @file
+#      This file defines the access paths and basic flags for LLVM
+#      clang, any version.
+#
+
+ToolRoot            = /usr
+
+# We'll accept any x.x or x.x.x version of clang with any build cruft
+# trailing behind the version number.
+
+ClangVersRegExp     = ([[:digit:]]{1,}\.*){2,3}
+ClangBuildRegExp    = .*
+
+# The LLVM binary utilities are released with, and share the version
+# of, clang.
+
+LLVMVersRegExp      = $(ClangVersRegExp)
+
+# We'll accept any version of binutils with any build cruft trailing
+# behind the version number, should it provide an alternate linker.
+
+BinutilsVersRegExp  = [[:digit:]]{1,}\.([[:digit:]]{1,}[-.]*){1,}
+BinutilsBuildRegExp = .*
+
+ClangBinDir         = $(ToolRoot)/bin
+ClangIncDir         = $(ToolRoot)/include
+ClangLibDir         = $(ToolRoot)/lib
+
+ToolBinDir          = $(ClangBinDir)
+ToolIncDir          = $(ClangIncDir)
+ToolLibDir          = $(ClangLibDir)
+
+# Include the LLVM clang common definitions.
+
+include target/tools/$(ToolVendor)/$(ToolProduct)/tools.mak